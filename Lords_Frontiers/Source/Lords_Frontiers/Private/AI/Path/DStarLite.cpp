@@ -5,6 +5,7 @@
 #include "Core/CoreManager.h"
 #include "EntitySystem/MovieSceneEntitySystemRunner.h"
 #include "Grid/GridManager.h"
+#include "Utilities/GameplayStats.h"
 
 #include "Kismet/GameplayStatics.h"
 
@@ -88,6 +89,9 @@ void UDStarLite::ComputeShortestPath()
 		return;
 	}
 
+	LF_SCOPE_CYCLE_COUNTER( Pathfinding );
+	FGameplayPerf::CountPathComputation();
+
 	FDStarNode& startNode = Nodes_.FindOrAdd( Start_, FDStarNode( Start_ ) );
 	while ( !Open_.empty() && ( Open_.top().Key < CalculateKey( startNode ) || startNode.RHS > startNode.G ) )
 	{
@@ -235,29 +239,20 @@ TArray<FIntPoint> UDStarLite::GetSuccessors( const FIntPoint& coord ) const
 		return TArray<FIntPoint>();
 	}
 
-	static const FIntPoint directions[8] = { { 1, 0 }, { -1, 0 }, { 0, 1 },  { 0, -1 },
-	                                         { 1, 1 }, { 1, -1 }, { -1, 1 }, { -1, -1 } };
-
-	const int32 width = Grid_->GetGridWidth();
-	const int32 height = Grid_->GetGridHeight();
+	const AGridManager* grid = Grid_.Get();
 
 	TArray<FIntPoint> successors;
-	for ( const FIntPoint& dir : directions )
-	{
-		FIntPoint next = coord + dir;
-
-		if ( next.X < 0 || next.X >= width || next.Y < 0 || next.Y >= height )
-		{
-			continue;
-		}
-
-		if ( !bIgnoreObstacles_ && !Grid_->GetCell( next.X, next.Y )->bIsWalkable )
-		{
-			continue;
-		}
-
-		successors.Add( next );
-	}
+	successors.Reserve( 8 );
+	grid->ForEachNeighbor(
+	    coord, true,
+	    [this, grid, &successors]( const FIntPoint& next )
+	    {
+		    if ( bIgnoreObstacles_ || grid->IsWalkableFast( next.X, next.Y ) )
+		    {
+			    successors.Add( next );
+		    }
+	    }
+	);
 
 	return successors;
 }
@@ -278,11 +273,12 @@ float UDStarLite::Cost( const FIntPoint& a, const FIntPoint& b ) const
 		return BIG_NUMBER;
 	}
 
+	const AGridManager* grid = Grid_.Get();
+
 	float timeToDestroy = 0.0f;
-	if ( const FGridCell* cell = Grid_->GetCell( b.X, b.Y ) )
+	if ( UnitDps_ != -1.0f && grid->IsBuildableFast( b.X, b.Y ) && grid->IsOccupiedFast( b.X, b.Y ) )
 	{
-		const TWeakObjectPtr<ABuilding> occupant = cell->bIsBuildable && cell->bIsOccupied ? cell->Occupant : nullptr;
-		if ( occupant.IsValid() && UnitDps_ != -1.0f )
+		if ( const ABuilding* occupant = grid->GetOccupantFast( b.X, b.Y ) )
 		{
 			timeToDestroy = occupant->Stats().Health() / UnitDps_;
 		}
@@ -297,11 +293,17 @@ float UDStarLite::Cost( const FIntPoint& a, const FIntPoint& b ) const
 	// Diagonal move
 	if ( dx == 1 && dy == 1 )
 	{
-		const FGridCell* cellX = Grid_->GetCell( a.X + ( b.X - a.X ), a.Y );
-		const FGridCell* cellY = Grid_->GetCell( a.X, a.Y + ( b.Y - a.Y ) );
+		auto isBlocked = [this, grid]( const int32 x, const int32 y )
+		{
+			if ( !grid->IsValidCoordsFast( x, y ) )
+			{
+				return true;
+			}
+			return !bIgnoreObstacles_ && ( !grid->IsWalkableFast( x, y ) || grid->IsOccupiedFast( x, y ) );
+		};
 
-		const bool cellXBlocked = !cellX || ( !bIgnoreObstacles_ && ( !cellX->bIsWalkable || cellX->bIsOccupied ) );
-		const bool cellYBlocked = !cellY || ( !bIgnoreObstacles_ && ( !cellY->bIsWalkable || cellY->bIsOccupied ) );
+		const bool cellXBlocked = isBlocked( b.X, a.Y );
+		const bool cellYBlocked = isBlocked( a.X, b.Y );
 
 		if ( cellXBlocked || cellYBlocked )
 		{
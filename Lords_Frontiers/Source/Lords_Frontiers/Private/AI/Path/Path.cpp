@@ -32,56 +32,86 @@ void UPath::OnUpdateCell( const FIntPoint& cell )
 void UPath::CalculateOrUpdate()
 {
 	DStarLite_->ComputeShortestPath();
-	PathPoints_ = DStarLite_->GetPath();
-	RebuildSpline();
+	TArray<FIntPoint> newPoints = DStarLite_->GetPath();
+
+	// Redraw only when the cell sequence actually changed
+	const bool bChanged = newPoints != PathPoints_ || !RenderedCells_.IsValid();
+	PathPoints_ = MoveTemp( newPoints );
+	if ( bChanged )
+	{
+		InternPoints();
+		RebuildSpline();
+	}
+}
+
+void UPath::InternPoints()
+{
+	InternedCells_.Reset();
+	ConsumedPoints_ = 0;
+
+	if ( const AUnitAIManager* unitAIManager = FindUnitAIManager() )
+	{
+		if ( UPathPointsManager* pathPointsManager = unitAIManager->PathPointsManager() )
+		{
+			InternedCells_ = pathPointsManager->InternPath( PathPoints_ );
+		}
+	}
 }
 
 void UPath::RebuildSpline()
 {
-	if ( Spline_ )
+	ClearSpline();
+
+	ASplinePointConnector* renderer = FindPathRenderer();
+	if ( !renderer || !InternedCells_.IsValid() )
 	{
-		ClearSpline();
+		return;
 	}
 
 	float groundHeight = 0.f;
 	const AGridManager* grid = nullptr;
-	TSubclassOf<ASplinePointConnector> splineClass;
 
 	if ( const UCoreManager* cm = UGameplayStatics::GetGameInstance( GetWorld() )->GetSubsystem<UCoreManager>() )
 	{
 		if ( const AUnitAIManager* unitAIManager = cm->GetUnitAIManager() )
 		{
 			groundHeight = unitAIManager->GroundHeight() + 5.f;
-			splineClass = unitAIManager->SplineClass();
 		}
 		grid = cm->GetGridManager();
 	}
 
-	if ( !splineClass )
-	{
-		UE_LOG( LogTemp, Error, TEXT( "UPath: no spline class found. Cannot build spline" ) );
-		Spline_ = nullptr;
-	}
-
-	Spline_ = GetWorld()->SpawnActor<ASplinePointConnector>( splineClass );
-	if ( !IsValid( Spline_ ) )
-	{
-		UE_LOG( LogTemp, Error, TEXT( "UPath: failed to create spline" ) );
-		return;
-	}
-
+	TArray<FVector> worldPoints;
+	worldPoints.Reserve( PathPoints_.Num() );
 	for ( const FIntPoint& point : PathPoints_ )
 	{
-		FVector worldLocation;
+		FVector worldLocation = FVector::ZeroVector;
 		if ( grid )
 		{
 			grid->GetCellWorldCenter( point, worldLocation );
 		}
 
-		Spline_->AddPoint( FVector( worldLocation.X, worldLocation.Y, groundHeight ) );
+		worldPoints.Add( FVector( worldLocation.X, worldLocation.Y, groundHeight ) );
 	}
 
-	Spline_->BuildSpline();
+	if ( renderer->AcquirePath( InternedCells_, worldPoints ) )
+	{
+		RenderedCells_ = InternedCells_;
+	}
+}
+
+const AUnitAIManager* UPath::FindUnitAIManager() const
+{
+	if ( const UCoreManager* cm = UGameplayStatics::GetGameInstance( GetWorld() )->GetSubsystem<UCoreManager>() )
+	{
+		return cm->GetUnitAIManager();
+	}
+	return nullptr;
+}
+
+ASplinePointConnector* UPath::FindPathRenderer() const
+{
+	const AUnitAIManager* unitAIManager = FindUnitAIManager();
+	return unitAIManager ? unitAIManager->PathRenderer() : nullptr;
 }
 
 const TArray<FIntPoint>& UPath::GetPoints() const
@@ -92,12 +122,28 @@ const TArray<FIntPoint>& UPath::GetPoints() const
 void UPath::RemovePoint( int index )
 {
 	PathPoints_.RemoveAt( index );
+
+	// Points are consumed from the front; anything else needs a fresh lookup
+	if ( index == 0 )
+	{
+		++ConsumedPoints_;
+	}
+	else
+	{
+		InternPoints();
+	}
 }
 
 void UPath::ClearSpline()
 {
-	if ( Spline_ )
+	if ( !RenderedCells_.IsValid() )
+	{
+		return;
+	}
+
+	if ( ASplinePointConnector* renderer = FindPathRenderer() )
 	{
-		Spline_->Clear();
+		renderer->ReleasePath( RenderedCells_.Get() );
 	}
+	RenderedCells_.Reset();
 }
@@ -173,6 +173,7 @@ void UPathPointsManager::Empty()
 		}
 	}
 	PathPoints_.Empty();
+	InternedPaths_.Empty();
 	bPointsVisible_ = false;
 }
 
@@ -255,15 +256,57 @@ bool UPathPointsManager::ActorIsOnPath( const AActor* actor, const UPath* path )
 	}
 
 	const FIntPoint enemyCoords = grid->GetCellCoords( actor->GetActorLocation() );
-	// Path points storage will probably be reimplemented so this may be optimized in future
-	for ( const FIntPoint& point : path->GetPoints() )
+	return path->ContainsCellIndex( grid->GetRuntimeCellIndex( enemyCoords ) );
+}
+
+TSharedPtr<const FInternedPathCells> UPathPointsManager::InternPath( const TArray<FIntPoint>& cells )
+{
+	if ( !Grid_.IsValid() )
 	{
-		if ( point == enemyCoords )
+		GetAccessToGrid();
+
+		if ( !Grid_.IsValid() )
 		{
-			return true;
+			UE_LOG( LogTemp, Error, TEXT( "PathPointsManager: Grid_ is not valid. Cannot intern path" ) );
+			return nullptr;
 		}
 	}
-	return false;
+
+	uint32 hash = GetTypeHash( cells.Num() );
+	for ( const FIntPoint& cell : cells )
+	{
+		hash = HashCombineFast( hash, GetTypeHash( cell ) );
+	}
+
+	TArray<TWeakPtr<const FInternedPathCells>>& bucket = InternedPaths_.FindOrAdd( hash );
+	for ( int32 i = bucket.Num() - 1; i >= 0; --i )
+	{
+		TSharedPtr<const FInternedPathCells> existing = bucket[i].Pin();
+		if ( !existing.IsValid() )
+		{
+			bucket.RemoveAtSwap( i, EAllowShrinking::No );
+			continue;
+		}
+		if ( existing->Cells == cells )
+		{
+			return existing;
+		}
+	}
+
+	TSharedRef<FInternedPathCells> interned = MakeShared<FInternedPathCells>();
+	interned->Cells = cells;
+	interned->PositionByCellIndex.Reserve( cells.Num() );
+	for ( int32 i = 0; i < cells.Num(); ++i )
+	{
+		const int32 cellIndex = Grid_->GetRuntimeCellIndex( cells[i] );
+		if ( cellIndex != INDEX_NONE )
+		{
+			interned->PositionByCellIndex.Add( cellIndex, i );
+		}
+	}
+
+	bucket.Add( interned );
+	return interned;
 }
 
 TWeakObjectPtr<APathTargetPoint>
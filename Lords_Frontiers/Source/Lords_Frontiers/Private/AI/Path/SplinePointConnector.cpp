@@ -1,10 +1,12 @@
 #include "AI/Path/SplinePointConnector.h"
 
-#include "AI/UnitAIManager.h"
-#include "Core/CoreManager.h"
-
 #include "Components/SplineComponent.h"
-#include "Kismet/GameplayStatics.h"
+
+namespace
+{
+	// Sections per mesh component; a section change rebuilds the proxy of its component only
+	constexpr int32 cSectionsPerMesh = 8;
+} // namespace
 
 ASplinePointConnector::ASplinePointConnector()
 {
@@ -17,120 +19,115 @@ ASplinePointConnector::ASplinePointConnector()
 	ProcMesh_ = CreateDefaultSubobject<UProceduralMeshComponent>( TEXT( "ProcMesh" ) );
 	ProcMesh_->AttachToComponent( SplineComponent_, FAttachmentTransformRules::KeepRelativeTransform );
 	ProcMesh_->SetCastShadow( false );
+	ProcMesh_->SetCollisionEnabled( ECollisionEnabled::NoCollision );
+	ProcMeshes_.Add( ProcMesh_ );
 }
 
-void ASplinePointConnector::AddPoint( FVector worldPosition, bool rebuild )
+bool ASplinePointConnector::AcquirePath(
+    const TSharedPtr<const FInternedPathCells>& cells, const TArray<FVector>& worldPoints
+)
 {
-	if ( !IsValid( SplineComponent_ ) )
+	if ( !cells.IsValid() || cells->Cells.Num() < 2 || cells->Cells.Num() != worldPoints.Num() )
 	{
-		return;
+		return false;
 	}
-	SplinePoints_.Add( worldPosition );
-	if ( rebuild )
+
+	// Equal sequences are interned to the same object, so its address identifies the section
+	if ( FPathRenderSection* existing = Sections_.Find( cells.Get() ) )
 	{
-		BuildSpline();
+		++existing->RefCount;
+		return true;
 	}
+
+	FPathRenderSection& section = Sections_.Add( cells.Get() );
+	section.Cells = cells;
+	section.RefCount = 1;
+	section.Slot = AllocateSlot();
+
+	BuildSection( section.Slot, worldPoints );
+	return true;
 }
 
-void ASplinePointConnector::RemovePoint( int32 index )
+void ASplinePointConnector::ReleasePath( const FInternedPathCells* cells )
 {
-	if ( !SplinePoints_.IsValidIndex( index ) )
+	FPathRenderSection* section = Sections_.Find( cells );
+	if ( !section || --section->RefCount > 0 )
 	{
-		UE_LOG(
-		    LogTemp, Warning, TEXT( "ASplinePointConnector::RemovePoint — Index %d out of range (%d points)" ), index,
-		    SplinePoints_.Num()
-		);
 		return;
 	}
 
-	USplineComponent* spline = SplineComponent_.Get();
-	FVector arrivePrev, leavePrev, arriveNext, leaveNext;
-	const bool bHasPrev = SplinePoints_.IsValidIndex( index - 1 );
-	const bool bHasNext = SplinePoints_.IsValidIndex( index + 1 );
+	GetMeshForSlot( section->Slot )->ClearMeshSection( section->Slot % cSectionsPerMesh );
+	FreeSlots_.Add( section->Slot );
+	Sections_.Remove( cells );
+}
 
-	if ( bHasPrev )
-	{
-		arrivePrev = spline->GetArriveTangentAtSplinePoint( index - 1, ESplineCoordinateSpace::World );
-		leavePrev = spline->GetLeaveTangentAtSplinePoint( index - 1, ESplineCoordinateSpace::World );
-	}
-	if ( bHasNext )
+void ASplinePointConnector::Clear()
+{
+	Sections_.Empty();
+	FreeSlots_.Empty();
+	NextSlot_ = 0;
+	SplineComponent_->ClearSplinePoints();
+	for ( UProceduralMeshComponent* mesh : ProcMeshes_ )
 	{
-		arriveNext = spline->GetArriveTangentAtSplinePoint( index + 1, ESplineCoordinateSpace::World );
-		leaveNext = spline->GetLeaveTangentAtSplinePoint( index + 1, ESplineCoordinateSpace::World );
+		mesh->ClearAllMeshSections();
 	}
+}
 
-	SplinePoints_.RemoveAt( index );
-	BuildSpline();
-
-	if ( bHasPrev && SplinePoints_.IsValidIndex( index - 1 ) )
+int32 ASplinePointConnector::AllocateSlot()
+{
+	if ( FreeSlots_.Num() > 0 )
 	{
-		spline->SetTangentsAtSplinePoint( index - 1, arrivePrev, leavePrev, ESplineCoordinateSpace::World );
+		return FreeSlots_.Pop( EAllowShrinking::No );
 	}
-	if ( bHasNext && SplinePoints_.IsValidIndex( index ) )
+
+	const int32 slot = NextSlot_++;
+	if ( slot / cSectionsPerMesh >= ProcMeshes_.Num() )
 	{
-		spline->SetTangentsAtSplinePoint( index, arriveNext, leaveNext, ESplineCoordinateSpace::World );
+		UProceduralMeshComponent* mesh = NewObject<UProceduralMeshComponent>( this );
+		mesh->SetupAttachment( SplineComponent_ );
+		mesh->SetCastShadow( false );
+		mesh->SetCollisionEnabled( ECollisionEnabled::NoCollision );
+		mesh->RegisterComponent();
+		ProcMeshes_.Add( mesh );
 	}
+	return slot;
+}
 
-	spline->UpdateSpline();
-	RebuildMesh();
+UProceduralMeshComponent* ASplinePointConnector::GetMeshForSlot( const int32 slot ) const
+{
+	return ProcMeshes_[slot / cSectionsPerMesh];
 }
 
-void ASplinePointConnector::BuildSpline()
+void ASplinePointConnector::BuildSection( const int32 slot, const TArray<FVector>& worldPoints )
 {
 	USplineComponent* spline = SplineComponent_.Get();
 	spline->ClearSplinePoints( false );
 
 	const FTransform& t = spline->GetComponentTransform();
-	for ( int32 i = 0; i < SplinePoints_.Num(); i++ )
+	for ( int32 i = 0; i < worldPoints.Num(); i++ )
 	{
 		FSplinePoint p;
 		p.InputKey = static_cast<float>( i );
-		p.Position = t.InverseTransformPosition( SplinePoints_[i] );
+		p.Position = t.InverseTransformPosition( worldPoints[i] );
 		p.Type = ESplinePointType::Curve;
 		spline->AddPoint( p, false );
 	}
 	spline->UpdateSpline();
-	RebuildMesh();
-}
-
-void ASplinePointConnector::Clear()
-{
-	SplinePoints_.Empty();
-	SplineComponent_->ClearSplinePoints();
-	ProcMesh_->ClearAllMeshSections();
-}
 
-void ASplinePointConnector::BeginPlay()
-{
-	Super::BeginPlay();
-	if ( UCoreManager* cm = UGameplayStatics::GetGameInstance( GetWorld() )->GetSubsystem<UCoreManager>() )
-	{
-		if ( AUnitAIManager* aiManager = cm->GetUnitAIManager() )
-		{
-			Height_ = aiManager->GroundHeight();
-		}
-	}
-	Height_ += HeightOffset_;
-}
-
-void ASplinePointConnector::RebuildMesh()
-{
-	ProcMesh_->ClearAllMeshSections();
-	if ( SplinePoints_.Num() < 2 )
-	{
-		return;
-	}
-
-	USplineComponent* spline = SplineComponent_.Get();
 	const float totalLength = spline->GetSplineLength();
 
 	const float arrowTip = FMath::Max( totalLength - ArrowOffset_, totalLength * 0.5f );
 	const float arrowStartDist = FMath::Max( arrowTip - ArrowHeadLength_, 0.f );
 
+	const int32 vertexCount = ( SampleCount_ + 1 ) * 2 + 3;
 	TArray<FVector> vertices;
 	TArray<int32> triangles;
 	TArray<FVector> normals;
 	TArray<FVector2D> uvs;
+	vertices.Reserve( vertexCount );
+	normals.Reserve( vertexCount );
+	uvs.Reserve( vertexCount );
+	triangles.Reserve( SampleCount_ * 6 + 3 );
 
 	const float overlap = ArrowHeadLength_ * 0.3f; // tweak (0.2–0.5 works well)
 
@@ -145,7 +142,7 @@ void ASplinePointConnector::RebuildMesh()
 	);
 	BuildTriangles( vertices.Num(), triangles );
 
-	const FVector rawTip = SplinePoints_.Last();
+	const FVector rawTip = worldPoints.Last();
 
 	const FVector tipTangent =
 	    spline->GetTangentAtDistanceAlongSpline( totalLength, ESplineCoordinateSpace::World ).GetSafeNormal();
@@ -181,12 +178,14 @@ void ASplinePointConnector::RebuildMesh()
 	triangles.Add( arrowBase + 2 );
 	triangles.Add( arrowBase + 1 );
 
-	ProcMesh_->CreateMeshSection(
-	    0, vertices, triangles, normals, uvs, TArray<FColor>(), TArray<FProcMeshTangent>(), false
+	UProceduralMeshComponent* mesh = GetMeshForSlot( slot );
+	const int32 sectionIndex = slot % cSectionsPerMesh;
+	mesh->CreateMeshSection(
+	    sectionIndex, vertices, triangles, normals, uvs, TArray<FColor>(), TArray<FProcMeshTangent>(), false
 	);
 	if ( IsValid( LineMaterial_ ) )
 	{
-		ProcMesh_->SetMaterial( 0, LineMaterial_ );
+		mesh->SetMaterial( sectionIndex, LineMaterial_ );
 	}
 }
 
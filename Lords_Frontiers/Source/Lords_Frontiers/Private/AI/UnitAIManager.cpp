@@ -4,6 +4,7 @@
 
 #include "AI/Path/PathPointsManager.h"
 #include "AI/Path/PathTargetPoint.h"
+#include "AI/Path/SplinePointConnector.h"
 #include "AI/TargetBuildingTracker.h"
 
 #include "Kismet/GameplayStatics.h"
@@ -41,6 +42,17 @@ void AUnitAIManager::BeginPlay()
 
 	// TargetBuildingTracker settings
 	TargetBuildingTracker_->Initialize();
+
+	if ( SplineClass_ )
+	{
+		FActorSpawnParameters spawnInfo;
+		spawnInfo.Owner = this;
+		PathRenderer_ = GetWorld()->SpawnActor<ASplinePointConnector>( SplineClass_, spawnInfo );
+	}
+	else
+	{
+		UE_LOG( LogTemp, Warning, TEXT( "AUnitAIManager: SplineClass_ not set. Unit paths will not be drawn" ) );
+	}
 }
 
 void AUnitAIManager::FindGoalActor()
@@ -6,6 +6,7 @@
 #include "EntityStats.h"
 #include "Grid/GridCell.h"
 #include "Grid/GridManager.h"
+#include "Utilities/GameplayStats.h"
 
 #include "Engine/BlueprintGeneratedClass.h"
 #include "Engine/SCS_Node.h"
@@ -17,33 +18,39 @@ UBuildingBonusComponent::UBuildingBonusComponent()
 
 void UBuildingBonusComponent::RecalculateBonuses( AGridManager* gridManager, const FIntPoint& myCellCoordinate )
 {
-	RemoveAppliedBonuses();
-
-	FGridCell* myCell = gridManager->GetCell( myCellCoordinate.X, myCellCoordinate.Y );
-	if ( !myCell )
-	{
-		return;
-	}
+	LF_SCOPE_CYCLE_COUNTER( BonusRecalc );
 
 	ABuilding* target = Cast<ABuilding>( GetOwner() );
 	if ( !target )
 	{
+		RemoveAppliedBonuses();
 		return;
 	}
 
-	for ( int32 i = 0; i < BonusEntries_.Num(); ++i )
+	// Removing and re-adding the same bonuses recomputes each touched stat once, at the end.
+	FEntityStats& targetStats = target->Stats();
+	targetStats.BeginModifierBatch();
+
+	RemoveAppliedBonuses();
+
+	const FGridCell* myCell = gridManager->GetCell( myCellCoordinate.X, myCellCoordinate.Y );
+	for ( int32 i = 0; myCell && i < BonusEntries_.Num(); ++i )
 	{
-		TArray<FGridCell*> neighborsCells =
-		    gridManager->GetCellsByShape( myCellCoordinate, BonusEntries_[i].Radius, BonusEntries_[i].Shape );
-		for ( const FGridCell* cell : neighborsCells )
-		{
-			ABuilding* occupant = Cast<ABuilding>( cell->Occupant.Get() );
-			if ( occupant && occupant->IsA( BonusEntries_[i].SourceBuildingClass ) )
-			{
-				ApplySingleBonus( target, i );
-			}
-		}
+		const FBuildingBonusEntry& entry = BonusEntries_[i];
+		gridManager->ForEachCellInShape(
+		    myCellCoordinate, entry.Radius, entry.Shape,
+		    [this, target, i, &entry]( const FGridCell& cell )
+		    {
+			    ABuilding* occupant = cell.Occupant.Get();
+			    if ( occupant && occupant->IsA( entry.SourceBuildingClass ) )
+			    {
+				    ApplySingleBonus( target, i );
+			    }
+		    }
+		);
 	}
+
+	targetStats.EndModifierBatch();
 }
 
 void UBuildingBonusComponent::RemoveAppliedBonuses()
@@ -86,7 +93,7 @@ void UBuildingBonusComponent::ApplySingleBonus( ABuilding* target, int32 entryIn
 		break;
 
 	case EBonusCategory::Stats:
-		target->Stats().AddStat( entry.StatType, entry.Value );
+		target->Stats().PushModifier( entry.StatType, FStatModifierSource( this, entryIndex ), entry.Value );
 		activeBonus = true;
 		break;
 	}
@@ -145,7 +152,7 @@ void UBuildingBonusComponent::RevertSingleBonus( const FBonusApplication& applic
 		break;
 
 	case EBonusCategory::Stats:
-		targetRaw->Stats().AddStat( entry.StatType, ( application.AppliedValue_ * -1 ) );
+		targetRaw->Stats().PopModifier( entry.StatType, FStatModifierSource( this, application.EntryIndex_ ) );
 		break;
 	}
 }
@@ -268,20 +275,22 @@ bool UBuildingBonusComponent::HasMatchingNeighbor(
 
 	for ( const FBuildingBonusEntry& entry : entries )
 	{
-		TArray<FGridCell*> neighbors = gridManager->GetCellsByShape( candidate, entry.Radius, entry.Shape );
-
-		for ( const FGridCell* cell : neighbors )
+		const bool bCompleted = gridManager->ForEachCellInShape(
+		    candidate, entry.Radius, entry.Shape,
+		    [&entry]( const FGridCell& cell )
+		    {
+			    if ( !cell.bIsOccupied )
+			    {
+				    return true;
+			    }
+			    const ABuilding* occupant = cell.Occupant.Get();
+			    return !( occupant && occupant->IsA( entry.SourceBuildingClass ) );
+		    }
+		);
+
+		if ( !bCompleted )
 		{
-			if ( !cell || !cell->bIsOccupied )
-			{
-				continue;
-			}
-
-			ABuilding* occupant = Cast<ABuilding>( cell->Occupant.Get() );
-			if ( occupant && occupant->IsA( entry.SourceBuildingClass ) )
-			{
-				return true;
-			}
+			return true;
 		}
 	}
 	return false;
@@ -302,14 +311,15 @@ void UBuildingBonusComponent::CollectRadiusCells(
 			continue;
 		}
 
-		TArray<FGridCell*> cells = gridManager->GetCellsByShape( buildingCell, entry.Radius, entry.Shape );
-
-		for ( const FGridCell* cell : cells )
-		{
-			if ( cell && cell->bIsBuildable )
-			{
-				outCells.AddUnique( cell->GridCoords );
-			}
-		}
+		gridManager->ForEachCellInShape(
+		    buildingCell, entry.Radius, entry.Shape,
+		    [&outCells]( const FGridCell& cell )
+		    {
+			    if ( cell.bIsBuildable )
+			    {
+				    outCells.AddUnique( cell.GridCoords );
+			    }
+		    }
+		);
 	}
 }
\ No newline at end of file
@@ -3,9 +3,9 @@
 #include "Cards/CardSubsystem.h"
 #include "Core/CoreManager.h"
 #include "Core/Subsystems/HealthBarPoolSubsystem/HealthBarPoolSubsystem.h"
+#include "Core/Subsystems/VFXPoolSubsystem/VFXPoolSubsystem.h"
 #include "GeometryCacheComponent.h"
 #include "Lords_Frontiers/Public/Resources/EconomyComponent.h"
-#include "NiagaraFunctionLibrary.h"
 #include "Resources/EconomyComponent.h"
 #include "UI/HealthBar/HealthBarConfigDataAsset.h"
 #include "Utilities/TraceChannelMappings.h"
@@ -251,18 +251,24 @@ void ABuilding::SpawnConstructionVFX()
 		    ConstructionVFXTimerHandle_,
 		    [this]()
 		    {
-			    UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-			        GetWorld(), ResolvedConstructionVFX_, GetActorLocation(), GetActorRotation()
-			    );
+			    if ( UVFXPoolSubsystem* vfxPool = GetWorld()->GetSubsystem<UVFXPoolSubsystem>() )
+			    {
+				    vfxPool->SpawnAtLocation(
+				        ResolvedConstructionVFX_, GetActorLocation(), GetActorRotation(), FVector( 1.0f ), false
+				    );
+			    }
 		    },
 		    ResolvedConstructionDelay_, false
 		);
 	}
 	else
 	{
-		UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-		    GetWorld(), ResolvedConstructionVFX_, GetActorLocation(), GetActorRotation()
-		);
+		if ( UVFXPoolSubsystem* vfxPool = GetWorld()->GetSubsystem<UVFXPoolSubsystem>() )
+		{
+			vfxPool->SpawnAtLocation(
+			    ResolvedConstructionVFX_, GetActorLocation(), GetActorRotation(), FVector( 1.0f ), false
+			);
+		}
 	}
 }
 
@@ -273,9 +279,12 @@ void ABuilding::SpawnDestructionVFX()
 		return;
 	}
 
-	UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-	    GetWorld(), ResolvedDestructionVFX_, GetActorLocation(), GetActorRotation(), FVector( 1.0f ), true
-	);
+	if ( UVFXPoolSubsystem* vfxPool = GetWorld()->GetSubsystem<UVFXPoolSubsystem>() )
+	{
+		vfxPool->SpawnAtLocation(
+		    ResolvedDestructionVFX_, GetActorLocation(), GetActorRotation(), FVector( 1.0f ), false
+		);
+	}
 }
 
 void ABuilding::FinalizeRuin()
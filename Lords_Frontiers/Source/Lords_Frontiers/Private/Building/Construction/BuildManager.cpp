@@ -10,6 +10,7 @@
 #include "Core/CoreManager.h"
 #include "Core/Debug/DebugPlayerController.h"
 #include "Core/GameLoop/GameLoopManager.h"
+#include "Core/Subsystems/Replay/ReplaySubsystem.h"
 #include "DrawDebugHelpers.h"
 #include "Grid/GridManager.h"
 #include "Grid/GridVisualizer.h"
@@ -261,11 +262,7 @@ void ABuildManager::CancelPlacing()
 
 		if ( GridManager_ )
 		{
-			if ( FGridCell* originalCell = GridManager_->GetCell( OriginalCellCoords_.X, OriginalCellCoords_.Y ) )
-			{
-				originalCell->bIsOccupied = true;
-				originalCell->Occupant = RelocatedBuilding_;
-			}
+			GridManager_->SetCellOccupant( OriginalCellCoords_, RelocatedBuilding_ );
 			RecalculateBonusesAroundBuilding( RelocatedBuilding_, OriginalCellCoords_ );
 		}
 	}
@@ -402,8 +399,7 @@ bool ABuildManager::RelocateExistingBuilding( const FVector& cellWorldLocation )
 		return false;
 	}
 
-	FGridCell* newCell = GridManager_->GetCell( CurrentCellCoords_.X, CurrentCellCoords_.Y );
-	if ( !newCell )
+	if ( !GridManager_->IsValidCoords( CurrentCellCoords_.X, CurrentCellCoords_.Y ) )
 	{
 		return false;
 	}
@@ -412,8 +408,7 @@ bool ABuildManager::RelocateExistingBuilding( const FVector& cellWorldLocation )
 	RelocatedBuilding_->SetActorHiddenInGame( false );
 	RelocatedBuilding_->SetActorEnableCollision( true );
 
-	newCell->bIsOccupied = true;
-	newCell->Occupant = RelocatedBuilding_;
+	GridManager_->SetCellOccupant( CurrentCellCoords_, RelocatedBuilding_ );
 
 	const FResourceProduction relocationCost = RelocatedBuilding_->GetRelocationCost();
 	if ( UCoreManager* core = UCoreManager::Get( this ) )
@@ -477,13 +472,22 @@ void ABuildManager::ConfirmPlacing()
 	}
 	else
 	{
+		UReplaySubsystem* replay = UReplaySubsystem::Get( this );
 		if ( !bIsRelocating_ || !RelocatedBuilding_ )
 		{
 			success = TryPlaceNewBuilding( cellWorldLocation );
+			if ( success && replay )
+			{
+				replay->RecordPlaceBuilding( CurrentBuildingClass_, CurrentCellCoords_ );
+			}
 		}
 		else
 		{
 			success = RelocateExistingBuilding( cellWorldLocation );
+			if ( success && replay )
+			{
+				replay->RecordRelocateBuilding( OriginalCellCoords_, CurrentCellCoords_ );
+			}
 
 			if ( success && RelocatedBuilding_ )
 			{
@@ -511,6 +515,73 @@ void ABuildManager::ConfirmPlacing()
 }
 
 
+bool ABuildManager::PlaceBuildingAtCell( const TSubclassOf<ABuilding> buildingClass, const FIntPoint& cellCoords )
+{
+	StartPlacingBuilding( buildingClass );
+	if ( !bIsPlacing_ )
+	{
+		return false;
+	}
+
+	const bool bPlaced = ConfirmPlacingAtCell( cellCoords );
+	ResetPlacementState();
+	if ( GridVisualizer_ )
+	{
+		GridVisualizer_->HideBonusHighlight();
+	}
+	return bPlaced;
+}
+
+bool ABuildManager::RelocateBuildingToCell( const FIntPoint& fromCoords, const FIntPoint& toCoords )
+{
+	ABuilding* building = GridManager_ ? GridManager_->GetOccupantFast( fromCoords.X, fromCoords.Y ) : nullptr;
+	if ( !building )
+	{
+		return false;
+	}
+
+	StartRelocatingBuilding( building );
+	if ( !bIsRelocating_ )
+	{
+		return false;
+	}
+
+	if ( !ConfirmPlacingAtCell( toCoords ) )
+	{
+		// Puts the building back on its original cell.
+		CancelPlacing();
+		return false;
+	}
+
+	ResetPlacementState();
+	if ( GridVisualizer_ )
+	{
+		GridVisualizer_->HideBonusHighlight();
+	}
+	return true;
+}
+
+bool ABuildManager::RemoveBuildingAtCell( const FIntPoint& cellCoords )
+{
+	ABuilding* building = GridManager_ ? GridManager_->GetOccupantFast( cellCoords.X, cellCoords.Y ) : nullptr;
+	return building && RemoveExistingBuilding( building );
+}
+
+bool ABuildManager::ConfirmPlacingAtCell( const FIntPoint& cellCoords )
+{
+	CurrentCellCoords_ = cellCoords;
+	bHasValidCell_ = GridManager_ && GridManager_->IsValidCoords( cellCoords.X, cellCoords.Y );
+	bCanBuildHere_ = bHasValidCell_ && BuildingPlacementUtils::CanBuildAtCell( GridManager_, cellCoords );
+
+	FVector cellWorldLocation;
+	if ( !ValidatePlacement( cellWorldLocation ) )
+	{
+		return false;
+	}
+	return bIsRelocating_ && RelocatedBuilding_ ? RelocateExistingBuilding( cellWorldLocation )
+	                                            : TryPlaceNewBuilding( cellWorldLocation );
+}
+
 void ABuildManager::UpdateHoveredCell()
 {
 	if ( !GridManager_ || !GridVisualizer_ )
@@ -737,14 +808,7 @@ void ABuildManager::StartRelocatingBuilding( ABuilding* buildingToMove )
 	RelocatedBuilding_->SetActorHiddenInGame( true );
 	RelocatedBuilding_->SetActorEnableCollision( false );
 
-	if ( FGridCell* originalCell = GridManager_->GetCell( OriginalCellCoords_.X, OriginalCellCoords_.Y ) )
-	{
-		if ( originalCell->Occupant.Get() == RelocatedBuilding_ )
-		{
-			originalCell->bIsOccupied = false;
-			originalCell->Occupant.Reset();
-		}
-	}
+	GridManager_->ClearCellOccupant( OriginalCellCoords_, RelocatedBuilding_ );
 
 	if ( UBuildingBonusComponent* selfBonus = RelocatedBuilding_->FindComponentByClass<UBuildingBonusComponent>() )
 	{
@@ -834,27 +898,22 @@ void ABuildManager::RecalculateBonusesAroundBuilding( ABuilding* building, const
 
 void ABuildManager::RecalculateBonusesFromNeighbors( const int32 MaxBonusRadius, const FIntPoint& cellCoords )
 {
-	TArray<FGridCell*> neighbors = GridManager_->GetCellsInSquare( cellCoords, MaxBonusRadius );
-	for ( FGridCell* cell : neighbors )
-	{
-		if ( !cell || !cell->Occupant.IsValid() )
-		{
-			continue;
-		}
-
-		ABuilding* neighbor = Cast<ABuilding>( cell->Occupant.Get() );
-		if ( !neighbor )
-		{
-			continue;
-		}
-
-		UBuildingBonusComponent* neighborBonus = neighbor->FindComponentByClass<UBuildingBonusComponent>();
-
-		if ( neighborBonus )
-		{
-			neighborBonus->RecalculateBonuses( GridManager_, cell->GridCoords );
-		}
-	}
+	GridManager_->ForEachCellInShape<EBonusShape::Square>(
+	    cellCoords, MaxBonusRadius,
+	    [this]( const FGridCell& cell )
+	    {
+		    ABuilding* neighbor = cell.Occupant.Get();
+		    if ( !neighbor )
+		    {
+			    return;
+		    }
+
+		    if ( UBuildingBonusComponent* neighborBonus = neighbor->FindComponentByClass<UBuildingBonusComponent>() )
+		    {
+			    neighborBonus->RecalculateBonuses( GridManager_, cell.GridCoords );
+		    }
+	    }
+	);
 
 	if ( UCoreManager* core = UCoreManager::Get( this ) )
 	{
@@ -894,20 +953,20 @@ ABuildManager::CollectBonusPreview( TSubclassOf<ABuilding> buildingClass, const
 
 		for ( int32 i = 0; i < entries.Num(); ++i )
 		{
-			TArray<FGridCell*> neighbors =
-			    GridManager_->GetCellsByShape( cellCoords, entries[i].Radius, entries[i].Shape );
-
-			for ( const FGridCell* cell : neighbors )
-			{
-				ABuilding* occupant = Cast<ABuilding>( cell->Occupant.Get() );
-				if ( occupant && occupant->IsA( entries[i].SourceBuildingClass ) )
-				{
-					FBonusIconData iconData = bonusComp->GetInfoSingleBonus( i, worldLocation );
-					iconData.BuildingIcon = cdo->BuildingIcon;
-					iconData.CellCoords = cellCoords;
-					result.Add( iconData );
-				}
-			}
+			GridManager_->ForEachCellInShape(
+			    cellCoords, entries[i].Radius, entries[i].Shape,
+			    [&]( const FGridCell& cell )
+			    {
+				    ABuilding* occupant = cell.Occupant.Get();
+				    if ( occupant && occupant->IsA( entries[i].SourceBuildingClass ) )
+				    {
+					    FBonusIconData iconData = bonusComp->GetInfoSingleBonus( i, worldLocation );
+					    iconData.BuildingIcon = cdo->BuildingIcon;
+					    iconData.CellCoords = cellCoords;
+					    result.Add( iconData );
+				    }
+			    }
+			);
 		}
 	}
 
@@ -925,68 +984,62 @@ void ABuildManager::CollectBonusFromNeighbors(
 		return;
 	}
 
-	TArray<FGridCell*> neighborsCells =
-	    GridManager_->GetCellsInSquare( myCellCoords, UBuildingBonusComponent::MaxPossibleBonusRadius );
-
-	if ( neighborsCells.IsEmpty() )
-	{
-		return;
-	}
-
-	for ( const FGridCell* cell : neighborsCells )
-	{
-		if ( !cell || !cell->bIsOccupied )
-		{
-			continue;
-		}
-
-		ABuilding* neighbor = Cast<ABuilding>( cell->Occupant.Get() );
-		if ( !neighbor )
-		{
-			continue;
-		}
-
-		UBuildingBonusComponent* bonusComp = neighbor->FindComponentByClass<UBuildingBonusComponent>();
-		if ( !bonusComp )
-		{
-			continue;
-		}
-
-		const TArray<FBuildingBonusEntry>& entries = bonusComp->GetBonusEntries();
-
-		for ( int32 i = 0; i < entries.Num(); ++i )
-		{
-
-			const int32 dx = FMath::Abs( myCellCoords.X - cell->GridCoords.X );
-			const int32 dy = FMath::Abs( myCellCoords.Y - cell->GridCoords.Y );
-			bool bInRange = false;
-
-			if ( entries[i].Shape == EBonusShape::Cross )
-			{
-				bInRange = ( dx == 0 || dy == 0 ) && FMath::Max( dx, dy ) <= entries[i].Radius;
-			}
-			else
-			{
-				bInRange = FMath::Max( dx, dy ) <= entries[i].Radius;
-			}
-
-			if ( !bInRange )
-			{
-				continue;
-			}
-			if ( cdo->IsA( entries[i].SourceBuildingClass ) )
-			{
-				FVector neighborWorldLocation;
-				if ( GridManager_->GetCellWorldCenter( cell->GridCoords, neighborWorldLocation ) )
-				{
-					FBonusIconData iconData = bonusComp->GetInfoSingleBonus( i, neighborWorldLocation );
-					iconData.BuildingIcon = neighbor->BuildingIcon;
-					iconData.CellCoords = cell->GridCoords;
-					result.Add( iconData );
-				}
-			}
-		}
-	}
+	GridManager_->ForEachCellInShape<EBonusShape::Square>(
+	    myCellCoords, UBuildingBonusComponent::MaxPossibleBonusRadius,
+	    [this, &myCellCoords, &result, cdo]( const FGridCell& cell )
+	    {
+		    if ( !cell.bIsOccupied )
+		    {
+			    return;
+		    }
+
+		    ABuilding* neighbor = cell.Occupant.Get();
+		    if ( !neighbor )
+		    {
+			    return;
+		    }
+
+		    UBuildingBonusComponent* bonusComp = neighbor->FindComponentByClass<UBuildingBonusComponent>();
+		    if ( !bonusComp )
+		    {
+			    return;
+		    }
+
+		    const TArray<FBuildingBonusEntry>& entries = bonusComp->GetBonusEntries();
+
+		    for ( int32 i = 0; i < entries.Num(); ++i )
+		    {
+			    const int32 dx = FMath::Abs( myCellCoords.X - cell.GridCoords.X );
+			    const int32 dy = FMath::Abs( myCellCoords.Y - cell.GridCoords.Y );
+			    bool bInRange = false;
+
+			    if ( entries[i].Shape == EBonusShape::Cross )
+			    {
+				    bInRange = ( dx == 0 || dy == 0 ) && FMath::Max( dx, dy ) <= entries[i].Radius;
+			    }
+			    else
+			    {
+				    bInRange = FMath::Max( dx, dy ) <= entries[i].Radius;
+			    }
+
+			    if ( !bInRange )
+			    {
+				    continue;
+			    }
+			    if ( cdo->IsA( entries[i].SourceBuildingClass ) )
+			    {
+				    FVector neighborWorldLocation;
+				    if ( GridManager_->GetCellWorldCenter( cell.GridCoords, neighborWorldLocation ) )
+				    {
+					    FBonusIconData iconData = bonusComp->GetInfoSingleBonus( i, neighborWorldLocation );
+					    iconData.BuildingIcon = neighbor->BuildingIcon;
+					    iconData.CellCoords = cell.GridCoords;
+					    result.Add( iconData );
+				    }
+			    }
+		    }
+	    }
+	);
 }
 
 void ABuildManager::AppendMatchingBonuses(
@@ -1139,13 +1192,13 @@ bool ABuildManager::RemoveExistingBuilding( ABuilding* buildingToRemove )
 		return false;
 	}
 
-	FGridCell* oldCell = GridManager_->GetCell( foundCoords.X, foundCoords.Y );
-	if ( oldCell && oldCell->Occupant.Get() == buildingToRemove )
+	if ( UReplaySubsystem* replay = UReplaySubsystem::Get( this ) )
 	{
-		oldCell->bIsOccupied = false;
-		oldCell->Occupant.Reset();
+		replay->RecordRemoveBuilding( foundCoords );
 	}
 
+	GridManager_->ClearCellOccupant( foundCoords, buildingToRemove );
+
 	RecalculateBonusesFromNeighbors( UBuildingBonusComponent::MaxPossibleBonusRadius, foundCoords );
 	buildingToRemove->SpawnDestructionVFX();
 	buildingToRemove->Destroy();
@@ -251,10 +251,5 @@ void UBuildingConstructionComponent::PlaceBuilding( const FIntPoint& cellCoords,
 	}
 
 	// Update cell state in grid.
-	FGridCell* cell = GridManager_->GetCell( cellCoords.X, cellCoords.Y );
-	if ( cell )
-	{
-		cell->bIsOccupied = true;
-		cell->Occupant = building;
-	}
+	GridManager_->SetCellOccupant( cellCoords, building );
 }
@@ -148,12 +148,7 @@ ABuilding* BuildingPlacementUtils::PlaceBuilding(
 
 	DrawDebugBox( world, worldLocation, FVector( 15.0f, 15.0f, 15.0f ), FColor::Cyan, false, 2.0f );
 
-	FGridCell* cell = gridManager->GetCell( cellCoords.X, cellCoords.Y );
-	if ( cell )
-	{
-		cell->bIsOccupied = true;
-		cell->Occupant = building;
-	}
+	gridManager->SetCellOccupant( cellCoords, building );
 
 	return building;
 }
@@ -2,6 +2,7 @@
 
 #include "Camera/CameraComponent.h"
 #include "Camera/StrategyCamera.h"
+#include "Core/Subsystems/CameraViewSubsystem/CameraViewSubsystem.h"
 
 #include "Engine/World.h"
 #include "GameFramework/SpringArmComponent.h"
@@ -22,29 +23,44 @@ namespace CameraZoomUtils
 			return 0.5f;
 		}
 
+		if ( const FCameraViewState* viewState = UCameraViewSubsystem::FindState( world ) )
+		{
+			return viewState->ZoomAlpha;
+		}
+
 		APawn* playerPawn = UGameplayStatics::GetPlayerPawn( world, 0 );
 		const AStrategyCamera* strategyCam = Cast<AStrategyCamera>( playerPawn );
-		if ( !strategyCam || !strategyCam->Camera )
+		if ( !strategyCam )
+		{
+			return 0.5f;
+		}
+
+		return ComputeZoomAlpha( *strategyCam );
+	}
+
+	float ComputeZoomAlpha( const AStrategyCamera& strategyCam )
+	{
+		if ( !strategyCam.Camera )
 		{
 			return 0.5f;
 		}
 
 		float currentZoom = 0.0f;
-		if ( strategyCam->Camera->ProjectionMode == ECameraProjectionMode::Orthographic )
+		if ( strategyCam.Camera->ProjectionMode == ECameraProjectionMode::Orthographic )
 		{
-			currentZoom = strategyCam->Camera->OrthoWidth;
+			currentZoom = strategyCam.Camera->OrthoWidth;
 		}
-		else if ( strategyCam->SpringArm )
+		else if ( strategyCam.SpringArm )
 		{
-			currentZoom = strategyCam->SpringArm->TargetArmLength;
+			currentZoom = strategyCam.SpringArm->TargetArmLength;
 		}
 		else
 		{
 			return 0.5f;
 		}
 
-		const float minZoom = FMath::Max( 1.0f, strategyCam->MinZoom() );
-		const float maxZoom = FMath::Max( minZoom + 1.0f, strategyCam->MaxZoom() );
+		const float minZoom = FMath::Max( 1.0f, strategyCam.MinZoom() );
+		const float maxZoom = FMath::Max( minZoom + 1.0f, strategyCam.MaxZoom() );
 		const float safeZoom = FMath::Clamp( currentZoom, minZoom, maxZoom );
 
 		const float invCurrent = 1.0f / safeZoom;
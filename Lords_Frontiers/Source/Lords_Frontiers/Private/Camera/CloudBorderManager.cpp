@@ -25,6 +25,10 @@ void ACloudBorderManager::BeginPlay()
 
 			ismc->SetCollisionEnabled( ECollisionEnabled::NoCollision );
 			ismc->SetCastShadow( false );
+			if ( bAnimateInMaterial )
+			{
+				ismc->NumCustomDataFloats = 3;
+			}
 
 			ismc->RegisterComponent();
 			CloudISMCs.Add( ismc );
@@ -63,6 +67,14 @@ void ACloudBorderManager::GenerateClouds()
 		int32 matIndex = rng.RandRange( 0, CloudISMCs.Num() - 1 );
 		int32 instIndex = CloudISMCs[matIndex]->AddInstance( transform );
 
+		if ( bAnimateInMaterial )
+		{
+			UInstancedStaticMeshComponent* ismc = CloudISMCs[matIndex];
+			ismc->SetCustomDataValue( instIndex, 0, outwardDir.X, false );
+			ismc->SetCustomDataValue( instIndex, 1, outwardDir.Y, false );
+			ismc->SetCustomDataValue( instIndex, 2, randRot.Roll, false );
+		}
+
 		FCloudInstanceData data;
 		data.ComponentIndex = matIndex;
 		data.InstanceIndex = instIndex;
@@ -95,6 +107,21 @@ void ACloudBorderManager::GenerateClouds()
 			spawnCloud( spawnPos, outwardDir );
 		}
 	}
+
+	if ( bAnimateInMaterial )
+	{
+		for ( UInstancedStaticMeshComponent* ismc : CloudISMCs )
+		{
+			ismc->MarkRenderStateDirty();
+		}
+		PushMaterialParameters();
+	}
+	else
+	{
+		// Force the first CPU pass to write every instance.
+		AppliedZoomAlpha_ = -1.0f;
+		PendingInstanceUpdates_ = 0;
+	}
 }
 
 void ACloudBorderManager::Tick( float deltaTime )
@@ -128,39 +155,139 @@ void ACloudBorderManager::Tick( float deltaTime )
 
 	CurrentZoomAlpha = FMath::FInterpTo( CurrentZoomAlpha, targetAlpha, deltaTime, TransitionSpeed );
 
-	FRotator camRot = activeCamera->GetComponentRotation();
-	FRotator faceCameraRot = camRot;
+	if ( bAnimateInMaterial )
+	{
+		if ( FMath::Abs( CurrentZoomAlpha - AppliedZoomAlpha_ ) > AlphaUpdateTolerance )
+		{
+			AppliedZoomAlpha_ = CurrentZoomAlpha;
+			PushMaterialParameters();
+		}
+		return;
+	}
+
+	FRotator faceCameraRot = activeCamera->GetComponentRotation();
 	faceCameraRot.Pitch += 90.0f;
-	FQuat localRot = GetActorTransform().InverseTransformRotation( faceCameraRot.Quaternion() );
+	const FQuat localRot = GetActorTransform().InverseTransformRotation( faceCameraRot.Quaternion() );
+
+	const bool bAlphaChanged = FMath::Abs( CurrentZoomAlpha - AppliedZoomAlpha_ ) > AlphaUpdateTolerance;
+	const bool bRotationChanged =
+	    FMath::RadiansToDegrees( localRot.AngularDistance( AppliedCameraRot_ ) ) > RotationUpdateToleranceDeg;
+
+	if ( bAlphaChanged )
+	{
+		// Zoom moves and scales every cloud: a partial write would leave the border torn between two zooms
+		AppliedZoomAlpha_ = CurrentZoomAlpha;
+		AppliedCameraRot_ = localRot;
+		UpdateAllInstances( AppliedCameraRot_ );
+		return;
+	}
+
+	if ( bRotationChanged )
+	{
+		AppliedCameraRot_ = localRot;
+		PendingInstanceUpdates_ = CloudsData.Num();
+	}
+
+	if ( PendingInstanceUpdates_ > 0 )
+	{
+		UpdateInstanceSlice( AppliedCameraRot_ );
+	}
+}
+
+FTransform ACloudBorderManager::MakeCloudTransform( const FCloudInstanceData& data, const FQuat& localRot ) const
+{
+	const float hideFactor = 1.0f - AppliedZoomAlpha_;
+
+	FVector newLocation = data.BaseTransform.GetLocation();
+	newLocation.Z -= HideOffsetDown * hideFactor;
+	newLocation += data.OutwardDirection * HideOffsetOutward * hideFactor;
+
+	FRotator finalRot = localRot.Rotator();
+	finalRot.Roll += data.BaseTransform.Rotator().Roll;
+
+	return FTransform(
+	    finalRot.Quaternion(), newLocation, data.BaseTransform.GetScale3D() * FMath::Max( 0.1f, AppliedZoomAlpha_ )
+	);
+}
+
+void ACloudBorderManager::UpdateAllInstances( const FQuat& localRot )
+{
+	TArray<TArray<FTransform>> transforms;
+	transforms.SetNum( CloudISMCs.Num() );
+	for ( int32 i = 0; i < CloudISMCs.Num(); ++i )
+	{
+		if ( IsValid( CloudISMCs[i] ) )
+		{
+			transforms[i].SetNum( CloudISMCs[i]->GetInstanceCount() );
+		}
+	}
 
 	for ( const FCloudInstanceData& data : CloudsData )
 	{
-		float hideFactor = 1.0f - CurrentZoomAlpha;
+		if ( transforms.IsValidIndex( data.ComponentIndex ) &&
+		     transforms[data.ComponentIndex].IsValidIndex( data.InstanceIndex ) )
+		{
+			transforms[data.ComponentIndex][data.InstanceIndex] = MakeCloudTransform( data, localRot );
+		}
+	}
 
-		FVector newLocation = data.BaseTransform.GetLocation();
-		newLocation.Z -= HideOffsetDown * hideFactor;
-		newLocation += data.OutwardDirection * HideOffsetOutward * hideFactor;
+	for ( int32 i = 0; i < CloudISMCs.Num(); ++i )
+	{
+		if ( transforms[i].Num() > 0 )
+		{
+			CloudISMCs[i]->BatchUpdateInstancesTransforms( 0, transforms[i], false, true );
+		}
+	}
 
-		FTransform newTransform = data.BaseTransform;
-		newTransform.SetLocation( newLocation );
+	PendingInstanceUpdates_ = 0;
+}
 
-		FRotator finalRot = localRot.Rotator();
-		finalRot.Roll += data.BaseTransform.Rotator().Roll;
-		newTransform.SetRotation( finalRot.Quaternion() );
+void ACloudBorderManager::UpdateInstanceSlice( const FQuat& localRot )
+{
+	const int32 cloudCount = CloudsData.Num();
+	if ( cloudCount == 0 )
+	{
+		PendingInstanceUpdates_ = 0;
+		return;
+	}
 
-		newTransform.SetScale3D( data.BaseTransform.GetScale3D() * FMath::Max( 0.1f, CurrentZoomAlpha ) );
+	const int32 sliceCount = FMath::Min( PendingInstanceUpdates_, FMath::Max( 1, MaxInstanceUpdatesPerFrame ) );
 
-		if ( IsValid( CloudISMCs[data.ComponentIndex] ) )
+	TBitArray<> touchedComponents( false, CloudISMCs.Num() );
+	for ( int32 n = 0; n < sliceCount; ++n )
+	{
+		UpdateCursor_ = UpdateCursor_ % cloudCount;
+		const FCloudInstanceData& data = CloudsData[UpdateCursor_++];
+
+		UInstancedStaticMeshComponent* ismc = CloudISMCs.IsValidIndex( data.ComponentIndex )
+		                                          ? CloudISMCs[data.ComponentIndex].Get()
+		                                          : nullptr;
+		if ( IsValid( ismc ) )
 		{
-			CloudISMCs[data.ComponentIndex]->UpdateInstanceTransform( data.InstanceIndex, newTransform, false, false );
+			ismc->UpdateInstanceTransform( data.InstanceIndex, MakeCloudTransform( data, localRot ), false, false );
+			touchedComponents[data.ComponentIndex] = true;
 		}
 	}
+	PendingInstanceUpdates_ -= sliceCount;
+
+	for ( TConstSetBitIterator<> it( touchedComponents ); it; ++it )
+	{
+		CloudISMCs[it.GetIndex()]->MarkRenderStateDirty();
+	}
+}
+
+void ACloudBorderManager::PushMaterialParameters()
+{
+	const float hideFactor = 1.0f - FMath::Max( AppliedZoomAlpha_, 0.0f );
 
 	for ( UInstancedStaticMeshComponent* ismc : CloudISMCs )
 	{
-		if ( IsValid( ismc ) )
+		if ( !IsValid( ismc ) )
 		{
-			ismc->MarkRenderStateDirty();
+			continue;
 		}
+		ismc->SetScalarParameterValueOnMaterials( TEXT( "CloudHideFactor" ), hideFactor );
+		ismc->SetScalarParameterValueOnMaterials( TEXT( "CloudHideOffsetDown" ), HideOffsetDown );
+		ismc->SetScalarParameterValueOnMaterials( TEXT( "CloudHideOffsetOutward" ), HideOffsetOutward );
 	}
-}
\ No newline at end of file
+}
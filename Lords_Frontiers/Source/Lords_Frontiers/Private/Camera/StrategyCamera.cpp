@@ -1,6 +1,7 @@
 #include "Camera/StrategyCamera.h"
 
 #include "Core/DefaultGameInstance.h"
+#include "Core/Subsystems/CameraViewSubsystem/CameraViewSubsystem.h"
 #include "Grid/GridManager.h"
 #include "UI/GameHUD.h"
 
@@ -242,6 +243,11 @@ void AStrategyCamera::Tick( float deltaTime )
 	{
 		SetActorLocation( clampedLoc );
 	}
+
+	if ( UCameraViewSubsystem* viewSubsystem = GetWorld()->GetSubsystem<UCameraViewSubsystem>() )
+	{
+		viewSubsystem->Publish( *this );
+	}
 }
 
 void AStrategyCamera::SetupPlayerInputComponent( UInputComponent* playerInputComponent )
@@ -12,6 +12,7 @@
 #include "Core/Subsystems/SessionLogger/DamageEvent.h"
 #include "Entity.h"
 #include "EntityStats.h"
+#include "Utilities/GameplayStats.h"
 #include "Waves/WaveManager.h"
 
 DEFINE_LOG_CATEGORY_STATIC( LogCardEffectHost, Log, All );
@@ -472,6 +473,8 @@ void UCardEffectHostComponent::DispatchInternal( ECardTriggerReason reason, AAct
 		return;
 	}
 
+	LF_SCOPE_CYCLE_COUNTER( CardDispatch );
+
 	UCardSubsystem* subsystem = UCardSubsystem::Get( this );
 	UCardVisualSubsystem* visuals = UCardVisualSubsystem::Get( this );
 	ABuilding* building = Cast<ABuilding>( GetOwner() );
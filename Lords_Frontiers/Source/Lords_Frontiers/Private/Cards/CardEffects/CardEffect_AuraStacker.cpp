@@ -110,8 +110,11 @@ void UCardEffect_AuraStacker::Execute_Implementation( const FCardEffectContext&
 		return;
 	}
 
-	const float appliedDelta = CardStatReflection::ApplyStatDelta( building, StatName, diff );
-	host->SetCounter( appliedKey, appliedMilli + FMath::RoundToInt( appliedDelta * 1000.f ) );
+	const FStatModifierSource source( this, context.EventIndex );
+	if ( CardStatReflection::SetStatModifier( building, StatName, source, desired ) )
+	{
+		host->SetCounter( appliedKey, FMath::RoundToInt( desired * 1000.f ) );
+	}
 }
 
 void UCardEffect_AuraStacker::Revert_Implementation( const FCardEffectContext& context )
@@ -129,7 +132,7 @@ void UCardEffect_AuraStacker::Revert_Implementation( const FCardEffectContext& c
 	const int32 appliedMilli = host->GetCounter( appliedKey );
 	if ( appliedMilli != 0 )
 	{
-		CardStatReflection::ApplyStatDelta( building, StatName, -static_cast<float>( appliedMilli ) / 1000.f );
+		CardStatReflection::RemoveStatModifier( building, StatName, FStatModifierSource( this, context.EventIndex ) );
 		host->SetCounter( appliedKey, 0 );
 	}
 }
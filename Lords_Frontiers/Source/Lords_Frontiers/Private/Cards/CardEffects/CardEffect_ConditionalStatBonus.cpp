@@ -37,17 +37,17 @@ void UCardEffect_ConditionalStatBonus::Execute_Implementation( const FCardEffect
 	const int32 appliedMilli = host->GetCounter( key );
 	const bool bApplied = appliedMilli != 0;
 
+	const FStatModifierSource source( this, context.EventIndex );
 	if ( bConditionMet && !bApplied && !FMath::IsNearlyZero( BonusAmount ) )
 	{
-		const float delta = CardStatReflection::ApplyStatDelta( building, StatName, BonusAmount );
-		if ( !FMath::IsNearlyZero( delta ) )
+		if ( CardStatReflection::SetStatModifier( building, StatName, source, BonusAmount ) )
 		{
-			host->SetCounter( key, FMath::RoundToInt( delta * 1000.f ) );
+			host->SetCounter( key, FMath::RoundToInt( BonusAmount * 1000.f ) );
 		}
 	}
 	else if ( !bConditionMet && bApplied )
 	{
-		CardStatReflection::ApplyStatDelta( building, StatName, -static_cast<float>( appliedMilli ) / 1000.f );
+		CardStatReflection::RemoveStatModifier( building, StatName, source );
 		host->SetCounter( key, 0 );
 	}
 }
@@ -65,7 +65,7 @@ void UCardEffect_ConditionalStatBonus::Revert_Implementation( const FCardEffectC
 	const int32 appliedMilli = host->GetCounter( key );
 	if ( appliedMilli != 0 )
 	{
-		CardStatReflection::ApplyStatDelta( building, StatName, -static_cast<float>( appliedMilli ) / 1000.f );
+		CardStatReflection::RemoveStatModifier( building, StatName, FStatModifierSource( this, context.EventIndex ) );
 		host->SetCounter( key, 0 );
 	}
 }
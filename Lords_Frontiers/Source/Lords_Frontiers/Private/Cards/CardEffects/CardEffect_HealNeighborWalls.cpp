@@ -2,7 +2,9 @@
 
 #include "Building/AdditiveBuilding.h"
 #include "Building/Building.h"
+#include "Core/CoreManager.h"
 #include "EntityStats.h"
+#include "Grid/GridManager.h"
 
 #include "Engine/World.h"
 #include "EngineUtils.h"
@@ -34,23 +36,22 @@ void UCardEffect_HealNeighborWalls::Execute_Implementation( const FCardEffectCon
 
 	const float radiusSq = Radius * Radius;
 
-	for ( TActorIterator<AAdditiveBuilding> it( world ); it; ++it )
+	auto considerWall = [&]( AAdditiveBuilding* wall )
 	{
-		AAdditiveBuilding* wall = *it;
 		if ( !wall || wall->IsRuined() )
 		{
-			continue;
+			return;
 		}
 		const float distSq = FVector::DistSquared( origin, wall->GetActorLocation() );
 		if ( distSq > radiusSq )
 		{
-			continue;
+			return;
 		}
 
 		if ( !bHealClosestOnly )
 		{
 			wall->Stats().Heal( HealAmount );
-			continue;
+			return;
 		}
 
 		if ( distSq < closestDistSq )
@@ -58,6 +59,32 @@ void UCardEffect_HealNeighborWalls::Execute_Implementation( const FCardEffectCon
 			closestDistSq = distSq;
 			closest = wall;
 		}
+	};
+
+	// Walls live on the grid: scan only the cells the radius can reach instead of every wall in the world.
+	AGridManager* grid = nullptr;
+	if ( const UCoreManager* core = UCoreManager::Get( owner ) )
+	{
+		grid = core->GetGridManager();
+	}
+
+	const FIntPoint ownerCell = grid ? grid->GetCellCoords( origin ) : FIntPoint( -1, -1 );
+	if ( grid && ownerCell.X >= 0 && grid->GetCellSize() > 0.f )
+	{
+		const int32 cellRadius = FMath::CeilToInt32( Radius / grid->GetCellSize() );
+
+		considerWall( Cast<AAdditiveBuilding>( grid->GetOccupantFast( ownerCell.X, ownerCell.Y ) ) );
+		grid->ForEachCellInShape<EBonusShape::Square>(
+		    ownerCell, cellRadius,
+		    [&considerWall]( const FGridCell& cell ) { considerWall( Cast<AAdditiveBuilding>( cell.Occupant.Get() ) ); }
+		);
+	}
+	else
+	{
+		for ( TActorIterator<AAdditiveBuilding> it( world ); it; ++it )
+		{
+			considerWall( *it );
+		}
 	}
 
 	if ( bHealClosestOnly && closest )
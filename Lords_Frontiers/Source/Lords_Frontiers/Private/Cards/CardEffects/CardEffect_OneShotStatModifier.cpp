@@ -39,10 +39,11 @@ void UCardEffect_OneShotStatModifier::Execute_Implementation( const FCardEffectC
 	const FName shotsKey = MakeShotsKey( context.SourceCard.Get() );
 	const FName appliedKey = MakeOneShotAppliedKey( context.SourceCard.Get() );
 
+	const FStatModifierSource source( this, context.EventIndex );
 	const int32 previousApplied = host->GetCounter( appliedKey );
 	if ( previousApplied != 0 )
 	{
-		CardStatReflection::ApplyStatDelta( building, StatName, -static_cast<float>( previousApplied ) / 1000.f );
+		CardStatReflection::RemoveStatModifier( building, StatName, source );
 		host->SetCounter( appliedKey, 0 );
 	}
 
@@ -53,10 +54,9 @@ void UCardEffect_OneShotStatModifier::Execute_Implementation( const FCardEffectC
 		return;
 	}
 
-	const float applied = CardStatReflection::ApplyStatDelta( building, StatName, Delta );
-	if ( !FMath::IsNearlyZero( applied ) )
+	if ( !FMath::IsNearlyZero( Delta ) && CardStatReflection::SetStatModifier( building, StatName, source, Delta ) )
 	{
-		host->SetCounter( appliedKey, FMath::RoundToInt( applied * 1000.f ) );
+		host->SetCounter( appliedKey, FMath::RoundToInt( Delta * 1000.f ) );
 	}
 }
 
@@ -73,7 +73,7 @@ void UCardEffect_OneShotStatModifier::Revert_Implementation( const FCardEffectCo
 	const int32 previousApplied = host->GetCounter( appliedKey );
 	if ( previousApplied != 0 )
 	{
-		CardStatReflection::ApplyStatDelta( building, StatName, -static_cast<float>( previousApplied ) / 1000.f );
+		CardStatReflection::RemoveStatModifier( building, StatName, FStatModifierSource( this, context.EventIndex ) );
 		host->SetCounter( appliedKey, 0 );
 	}
 }
@@ -46,7 +46,8 @@ void UCardEffect_StackingBuff::Execute_Implementation( const FCardEffectContext&
 			*GetName(), accumMilli, -static_cast<float>( accumMilli ) / 1000.f, *StatName.ToString() );
 		if ( accumMilli != 0 )
 		{
-			CardStatReflection::ApplyStatDelta( building, StatName, -static_cast<float>( accumMilli ) / 1000.f );
+			const FStatModifierSource source( this, context.EventIndex );
+			CardStatReflection::RemoveStatModifier( building, StatName, source );
 			host->SetCounter( accumKey, 0 );
 		}
 		return;
@@ -82,15 +83,18 @@ void UCardEffect_StackingBuff::Execute_Implementation( const FCardEffectContext&
 		return;
 	}
 
-	const float appliedDelta = CardStatReflection::ApplyStatDelta( building, StatName, step );
-	if ( !FMath::IsNearlyZero( appliedDelta ) )
+	// The modifier holds the whole accumulated amount, so integer stats round once instead of per step.
+	const int32 newAccumMilli = accumMilli + FMath::RoundToInt( step * 1000.f );
+	const FStatModifierSource source( this, context.EventIndex );
+	const float newAccumulated = static_cast<float>( newAccumMilli ) / 1000.f;
+	if ( CardStatReflection::SetStatModifier( building, StatName, source, newAccumulated ) )
 	{
-		host->SetCounter( accumKey, accumMilli + FMath::RoundToInt( appliedDelta * 1000.f ) );
+		host->SetCounter( accumKey, newAccumMilli );
 	}
 	UE_LOG( LogCardStackingBuff, Verbose,
-		TEXT( "[%s] reason=%d accumBefore=%d stepIntended=%.3f appliedDelta=%.3f accumAfter=%d" ),
+		TEXT( "[%s] reason=%d accumBefore=%d step=%.3f accumAfter=%d" ),
 		*GetName(), static_cast<int32>( context.TriggerReason ),
-		accumMilli, step, appliedDelta, host->GetCounter( accumKey ) );
+		accumMilli, step, host->GetCounter( accumKey ) );
 }
 
 void UCardEffect_StackingBuff::Revert_Implementation( const FCardEffectContext& context )
@@ -107,7 +111,7 @@ void UCardEffect_StackingBuff::Revert_Implementation( const FCardEffectContext&
 	const int32 accumMilli = host->GetCounter( accumKey );
 	if ( accumMilli != 0 )
 	{
-		CardStatReflection::ApplyStatDelta( building, StatName, -static_cast<float>( accumMilli ) / 1000.f );
+		CardStatReflection::RemoveStatModifier( building, StatName, FStatModifierSource( this, context.EventIndex ) );
 		host->SetCounter( accumKey, 0 );
 	}
 }
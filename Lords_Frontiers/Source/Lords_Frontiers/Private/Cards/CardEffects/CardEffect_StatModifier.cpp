@@ -19,23 +19,24 @@ namespace
 
 void UCardEffect_StatModifier::Apply_Implementation( const FCardEffectContext& context )
 {
-	ApplyDelta( context, Delta );
+	ApplyDelta( context, true );
 }
 
 void UCardEffect_StatModifier::Revert_Implementation( const FCardEffectContext& context )
 {
-	ApplyDelta( context, -Delta );
+	ApplyDelta( context, false );
 }
 
-void UCardEffect_StatModifier::ApplyDelta( const FCardEffectContext& context, float signedDelta ) const
+void UCardEffect_StatModifier::ApplyDelta( const FCardEffectContext& context, bool bApply ) const
 {
 	ABuilding* building = context.Building.Get();
-	if ( !building )
+	if ( !building || FMath::IsNearlyZero( Delta ) )
 	{
 		return;
 	}
 
-	if ( !CardStatReflection::FindNumericProperty( StatName ) )
+	EStatsType statType;
+	if ( !CardStatReflection::FindStat( StatName, statType ) )
 	{
 		UE_LOG(
 		    LogCardStatModifier, Warning, TEXT( "StatName '%s' not found on FEntityStats — skipping" ),
@@ -44,7 +45,16 @@ void UCardEffect_StatModifier::ApplyDelta( const FCardEffectContext& context, fl
 		return;
 	}
 
-	CardStatReflection::ApplyStatDelta( building, StatName, signedDelta );
+	// Counted: the same card applied twice stacks, and each revert removes exactly one copy.
+	const FStatModifierSource source( this, context.EventIndex );
+	if ( bApply )
+	{
+		building->Stats().PushModifier( statType, source, Delta );
+	}
+	else
+	{
+		building->Stats().PopModifier( statType, source );
+	}
 }
 
 FText UCardEffect_StatModifier::GetDisplayText_Implementation() const
@@ -148,10 +158,5 @@ void UCardEffect_StatModifier::PreviewBuildingTooltip_Implementation(
 		return;
 	}
 
-	if ( !CardStatReflection::FindNumericProperty( StatName ) )
-	{
-		return;
-	}
-
 	CardStatReflection::ApplyStatDeltaToStats( InOutStats, StatName, Delta );
 }
@@ -2,20 +2,14 @@
 
 #include "Cards/CardDataAsset.h"
 
+#include "Math/RandomStream.h"
 #include "Math/UnrealMathUtility.h"
 
 namespace
 {
-	struct FWorkingBucket
-	{
-		ECardRarity Rarity       = ECardRarity::Common;
-		float       RarityWeight = 0.f;
-		TMap<UCardDataAsset*, float> Weights;
-	};
-
-	int32 PickIndexByWeight( const TArray<float>& weights, float totalWeight )
+	int32 PickIndexByWeight( const TArray<float>& weights, float totalWeight, FRandomStream& rng )
 	{
-		const float roll = FMath::FRand() * totalWeight;
+		const float roll = rng.FRand() * totalWeight;
 		float running    = 0.f;
 		for ( int32 i = 0; i < weights.Num(); ++i )
 		{
@@ -28,41 +22,234 @@ namespace
 		return weights.Num() - 1;
 	}
 
-	UCardDataAsset* PickCardFromBucket( FWorkingBucket& bucket )
+	/**
+	 * Fenwick tree over card weights for weighted picks without replacement:
+	 * O(n) build, O(log n) pick and remove.
+	 */
+	class FCardWeightTree
 	{
-		float totalWeight = 0.f;
-		TArray<UCardDataAsset*> keys;
-		TArray<float> values;
-		keys.Reserve( bucket.Weights.Num() );
-		values.Reserve( bucket.Weights.Num() );
+	public:
+		void Build( TArray<double>&& weights )
+		{
+			Weights_ = MoveTemp( weights );
+			const int32 count = Weights_.Num();
+			Tree_.Init( 0.0, count + 1 );
+			Total_    = 0.0;
+			Positive_ = 0;
+
+			for ( int32 i = 1; i <= count; ++i )
+			{
+				double& weight = Weights_[i - 1];
+				weight = FMath::Max( weight, 0.0 );
+				if ( weight > 0.0 )
+				{
+					Total_ += weight;
+					++Positive_;
+				}
 
-		for ( const auto& pair : bucket.Weights )
+				Tree_[i] += weight;
+				const int32 parent = i + ( i & -i );
+				if ( parent <= count )
+				{
+					Tree_[parent] += Tree_[i];
+				}
+			}
+
+			TopStep_ = 1;
+			while ( TopStep_ * 2 <= count )
+			{
+				TopStep_ *= 2;
+			}
+		}
+
+		bool HasWeight() const
 		{
-			if ( pair.Key && pair.Value > 0.f )
+			return Positive_ > 0 && Total_ > 0.0;
+		}
+
+		int32 Pick( FRandomStream& rng ) const
+		{
+			const int32 count = Weights_.Num();
+			double remaining  = rng.FRand() * Total_;
+
+			// Largest prefix still below the roll; the item after it is the pick
+			int32 position = 0;
+			for ( int32 step = TopStep_; step > 0; step >>= 1 )
 			{
-				keys.Add( pair.Key );
-				values.Add( pair.Value );
-				totalWeight += pair.Value;
+				const int32 next = position + step;
+				if ( next <= count && Tree_[next] < remaining )
+				{
+					position  = next;
+					remaining -= Tree_[next];
+				}
+			}
+
+			// Rounding can land on an emptied slot next to the intended one
+			int32 index = FMath::Min( position, count - 1 );
+			while ( index < count - 1 && Weights_[index] <= 0.0 )
+			{
+				++index;
 			}
+			while ( index > 0 && Weights_[index] <= 0.0 )
+			{
+				--index;
+			}
+			return index;
 		}
 
-		if ( keys.Num() == 0 || totalWeight <= 0.f )
+		void Remove( const int32 index )
 		{
-			return nullptr;
+			const double weight = Weights_[index];
+			if ( weight <= 0.0 )
+			{
+				return;
+			}
+
+			Weights_[index] = 0.0;
+			Total_ -= weight;
+			--Positive_;
+			for ( int32 i = index + 1; i < Tree_.Num(); i += i & -i )
+			{
+				Tree_[i] -= weight;
+			}
 		}
 
-		const int32 picked = PickIndexByWeight( values, totalWeight );
-		UCardDataAsset* card = keys[picked];
-		bucket.Weights.Remove( card );
-		return card;
+	private:
+		TArray<double> Weights_;
+		TArray<double> Tree_;
+		double         Total_    = 0.0;
+		int32          Positive_ = 0;
+		int32          TopStep_  = 1;
+	};
+
+	struct FWorkingBucket
+	{
+		ECardRarity Rarity       = ECardRarity::Common;
+		float       RarityWeight = 0.f;
+		TArray<UCardDataAsset*> Cards;
+		FCardWeightTree Weights;
+	};
+
+	template <typename TKey, typename TMultiplierMap>
+	void FoldMultipliers( TMap<TKey, double>& table, const TMultiplierMap& multipliers, int32 stackDelta )
+	{
+		for ( const auto& pair : multipliers )
+		{
+			const TKey key = pair.Key;
+			double& value = table.FindOrAdd( key, 1.0 );
+			value *= FMath::Pow( static_cast<double>( pair.Value ), static_cast<double>( stackDelta ) );
+		}
+	}
+}
+
+void FCardPoolResolver::OnCardApplied( UCardDataAsset* card, int32 stackCount )
+{
+	if ( !card )
+	{
+		return;
+	}
+
+	int32& stacks = Stacks_.FindOrAdd( card, 0 );
+	const int32 previousEffective = stacks > 0 ? GetEffectiveStacks( stacks ) : 0;
+	stacks = FMath::Max( stackCount, stacks + 1 );
+
+	if ( previousEffective == 0 )
+	{
+		for ( const TObjectPtr<UCardDataAsset>& exc : card->ExcludedCards )
+		{
+			if ( exc )
+			{
+				Excluded_.Add( exc );
+			}
+		}
+	}
+
+	const int32 stackDelta = GetEffectiveStacks( stacks ) - previousEffective;
+	if ( stackDelta > 0 )
+	{
+		ApplyInfluence( card, stackDelta );
+	}
+	WeightCache_.Reset();
+}
+
+void FCardPoolResolver::Reset()
+{
+	Stacks_.Reset();
+	Excluded_.Reset();
+	CardMultipliers_.Reset();
+	CategoryMultipliers_.Reset();
+	TagMultipliers_.Reset();
+	WeightCache_.Reset();
+}
+
+int32 FCardPoolResolver::GetEffectiveStacks( int32 stacks ) const
+{
+	return FMath::Min( FMath::Max( 1, stacks ), FMath::Max( 1, MaxStacksForWeightInfluence_ ) );
+}
+
+void FCardPoolResolver::ApplyInfluence( const UCardDataAsset* source, int32 stackDelta )
+{
+	FoldMultipliers( CardMultipliers_, source->WeightMultipliers_Up, stackDelta );
+	FoldMultipliers( CardMultipliers_, source->WeightMultipliers_Down, stackDelta );
+	FoldMultipliers( CategoryMultipliers_, source->CategoryWeightMultipliers_Up, stackDelta );
+	FoldMultipliers( CategoryMultipliers_, source->CategoryWeightMultipliers_Down, stackDelta );
+	FoldMultipliers( TagMultipliers_, source->TagWeightMultipliers_Up, stackDelta );
+	FoldMultipliers( TagMultipliers_, source->TagWeightMultipliers_Down, stackDelta );
+}
+
+void FCardPoolResolver::RebuildInfluence()
+{
+	CardMultipliers_.Reset();
+	CategoryMultipliers_.Reset();
+	TagMultipliers_.Reset();
+	WeightCache_.Reset();
+
+	for ( const TPair<UCardDataAsset*, int32>& pair : Stacks_ )
+	{
+		if ( pair.Key )
+		{
+			ApplyInfluence( pair.Key, GetEffectiveStacks( pair.Value ) );
+		}
+	}
+}
+
+float FCardPoolResolver::GetCardWeight( UCardDataAsset* card ) const
+{
+	if ( !card || Excluded_.Contains( card ) || ( !card->bCanStack && Stacks_.Contains( card ) ) )
+	{
+		return 0.f;
+	}
+
+	if ( const float* cached = WeightCache_.Find( card ) )
+	{
+		return *cached;
+	}
+
+	double weight = card->BaseWeight;
+	if ( const double* multiplier = CardMultipliers_.Find( card ) )
+	{
+		weight *= *multiplier;
+	}
+	if ( const double* multiplier = CategoryMultipliers_.Find( card->Category ) )
+	{
+		weight *= *multiplier;
+	}
+	for ( const FName& tag : card->Tags )
+	{
+		if ( const double* multiplier = TagMultipliers_.Find( tag ) )
+		{
+			weight *= *multiplier;
+		}
 	}
+
+	return WeightCache_.Add( card, static_cast<float>( weight ) );
 }
 
 TArray<UCardDataAsset*> FCardPoolResolver::Resolve(
 	const TArray<FCardRarityBucket>& buckets,
-	const TArray<FAppliedCardRecord>& history,
 	int32 countToOffer,
 	int32 maxCardsPerRarity,
+	FRandomStream& rng,
 	int32 maxStacksForWeightInfluence,
 	const TSet<UCardDataAsset*>& weightReducedCards,
 	float weightReductionMultiplier )
@@ -74,36 +261,12 @@ TArray<UCardDataAsset*> FCardPoolResolver::Resolve(
 		return result;
 	}
 
-	TSet<UCardDataAsset*> excludedByOtherCards;
-	for ( const FAppliedCardRecord& record : history )
+	if ( maxStacksForWeightInfluence != MaxStacksForWeightInfluence_ )
 	{
-		UCardDataAsset* source = record.Card;
-		if ( !source )
-		{
-			continue;
-		}
-
-		for ( const TObjectPtr<UCardDataAsset>& exc : source->ExcludedCards )
-		{
-			if ( exc )
-			{
-				excludedByOtherCards.Add( exc );
-			}
-		}
+		MaxStacksForWeightInfluence_ = maxStacksForWeightInfluence;
+		RebuildInfluence();
 	}
 
-	auto IsCardAlreadyApplied = [&]( UCardDataAsset* card )
-	{
-		for ( const FAppliedCardRecord& record : history )
-		{
-			if ( record.Card == card )
-			{
-				return true;
-			}
-		}
-		return false;
-	};
-
 	TArray<FWorkingBucket> workingBuckets;
 	workingBuckets.Reserve( buckets.Num() );
 
@@ -120,158 +283,48 @@ TArray<UCardDataAsset*> FCardPoolResolver::Resolve(
 		FWorkingBucket wb;
 		wb.Rarity       = src.Rarity;
 		wb.RarityWeight = src.RarityWeight;
-		wb.Weights.Reserve( src.Cards.Num() );
+		wb.Cards.Reserve( src.Cards.Num() );
+
+		TArray<double> weights;
+		weights.Reserve( src.Cards.Num() );
 
 		for ( UCardDataAsset* card : src.Cards )
 		{
-			if ( !card )
-			{
-				continue;
-			}
-			if ( excludedByOtherCards.Contains( card ) )
+			float weight = GetCardWeight( card );
+			if ( weight <= 0.f )
 			{
 				continue;
 			}
-			if ( !card->bCanStack && IsCardAlreadyApplied( card ) )
-			{
-				continue;
-			}
-
-			float weight = card->BaseWeight;
 			if ( bApplyReductionMultiplier && weightReducedCards.Contains( card ) )
 			{
 				weight *= clampedReductionMultiplier;
 			}
 
-			wb.Weights.Add( card, weight );
+			wb.Cards.Add( card );
+			weights.Add( weight );
 		}
 
-		if ( wb.Weights.Num() > 0 )
+		wb.Weights.Build( MoveTemp( weights ) );
+		if ( wb.Weights.HasWeight() )
 		{
 			workingBuckets.Add( MoveTemp( wb ) );
 		}
 	}
 
-	if ( workingBuckets.Num() == 0 )
-	{
-		return result;
-	}
-
-	auto applyMultiplierMap = [&]( const TMap<TObjectPtr<UCardDataAsset>, float>& map, int32 effectiveStacks )
-	{
-		for ( const auto& pair : map )
-		{
-			UCardDataAsset* target = pair.Key;
-			if ( !target )
-			{
-				continue;
-			}
-			for ( FWorkingBucket& wb : workingBuckets )
-			{
-				if ( float* weight = wb.Weights.Find( target ) )
-				{
-					for ( int32 i = 0; i < effectiveStacks; ++i )
-					{
-						*weight *= pair.Value;
-					}
-				}
-			}
-		}
-	};
-
-	auto applyCategoryMultiplierMap = [&]( const TMap<ECardCategory, float>& map, int32 effectiveStacks )
-	{
-		for ( const auto& pair : map )
-		{
-			const ECardCategory category = pair.Key;
-			const float multiplier       = pair.Value;
-			for ( FWorkingBucket& wb : workingBuckets )
-			{
-				for ( auto& weightPair : wb.Weights )
-				{
-					if ( weightPair.Key && weightPair.Key->Category == category )
-					{
-						for ( int32 i = 0; i < effectiveStacks; ++i )
-						{
-							weightPair.Value *= multiplier;
-						}
-					}
-				}
-			}
-		}
-	};
-
-	auto applyTagMultiplierMap = [&]( const TMap<FName, float>& map, int32 effectiveStacks )
-	{
-		for ( const auto& pair : map )
-		{
-			const FName tag        = pair.Key;
-			const float multiplier = pair.Value;
-			if ( tag.IsNone() )
-			{
-				continue;
-			}
-			for ( FWorkingBucket& wb : workingBuckets )
-			{
-				for ( auto& weightPair : wb.Weights )
-				{
-					if ( weightPair.Key && weightPair.Key->Tags.Contains( tag ) )
-					{
-						for ( int32 i = 0; i < effectiveStacks; ++i )
-						{
-							weightPair.Value *= multiplier;
-						}
-					}
-				}
-			}
-		}
-	};
-
-	for ( const FAppliedCardRecord& record : history )
-	{
-		UCardDataAsset* source = record.Card;
-		if ( !source )
-		{
-			continue;
-		}
-
-		const int32 rawStacks       = FMath::Max( 1, record.StackCount );
-		const int32 effectiveStacks = FMath::Min( rawStacks, FMath::Max( 1, maxStacksForWeightInfluence ) );
-
-		applyMultiplierMap( source->WeightMultipliers_Up, effectiveStacks );
-		applyMultiplierMap( source->WeightMultipliers_Down, effectiveStacks );
-		applyCategoryMultiplierMap( source->CategoryWeightMultipliers_Up, effectiveStacks );
-		applyCategoryMultiplierMap( source->CategoryWeightMultipliers_Down, effectiveStacks );
-		applyTagMultiplierMap( source->TagWeightMultipliers_Up, effectiveStacks );
-		applyTagMultiplierMap( source->TagWeightMultipliers_Down, effectiveStacks );
-	}
-
 	TMap<ECardRarity, int32> perRarityCount;
+	TArray<int32> candidateBucketIndices;
+	TArray<float> candidateBucketWeights;
 
 	while ( result.Num() < countToOffer )
 	{
-		TArray<int32> candidateBucketIndices;
-		TArray<float> candidateBucketWeights;
+		candidateBucketIndices.Reset();
+		candidateBucketWeights.Reset();
 		float candidateTotal = 0.f;
 
 		for ( int32 i = 0; i < workingBuckets.Num(); ++i )
 		{
-			FWorkingBucket& wb = workingBuckets[i];
-			const int32 already = perRarityCount.FindRef( wb.Rarity );
-			if ( already >= maxCardsPerRarity )
-			{
-				continue;
-			}
-
-			float bucketAvailableWeight = 0.f;
-			for ( const auto& pair : wb.Weights )
-			{
-				if ( pair.Value > 0.f )
-				{
-					bucketAvailableWeight += pair.Value;
-				}
-			}
-			if ( bucketAvailableWeight <= 0.f )
+			const FWorkingBucket& wb = workingBuckets[i];
+			if ( perRarityCount.FindRef( wb.Rarity ) >= maxCardsPerRarity || !wb.Weights.HasWeight() )
 			{
 				continue;
 			}
@@ -286,17 +339,14 @@ TArray<UCardDataAsset*> FCardPoolResolver::Resolve(
 			break;
 		}
 
-		const int32 pickedCandidate = PickIndexByWeight( candidateBucketWeights, candidateTotal );
-		const int32 bucketIdx       = candidateBucketIndices[pickedCandidate];
+		const int32 pickedCandidate = PickIndexByWeight( candidateBucketWeights, candidateTotal, rng );
+		FWorkingBucket& bucket      = workingBuckets[candidateBucketIndices[pickedCandidate]];
 
-		UCardDataAsset* picked = PickCardFromBucket( workingBuckets[bucketIdx] );
-		if ( !picked )
-		{
-			continue;
-		}
+		const int32 pickedCard = bucket.Weights.Pick( rng );
+		bucket.Weights.Remove( pickedCard );
 
-		result.Add( picked );
-		perRarityCount.FindOrAdd( workingBuckets[bucketIdx].Rarity )++;
+		result.Add( bucket.Cards[pickedCard] );
+		perRarityCount.FindOrAdd( bucket.Rarity )++;
 	}
 
 	return result;
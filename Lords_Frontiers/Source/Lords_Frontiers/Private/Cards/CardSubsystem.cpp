@@ -11,6 +11,8 @@
 #include "Cards/Visuals/CardVisualSubsystem.h"
 #include "Core/CoreManager.h"
 #include "Core/GameLoop/GameLoopManager.h"
+#include "Core/Subsystems/Replay/ReplaySubsystem.h"
+#include "Core/Subsystems/SessionRandom/SessionRandomSubsystem.h"
 #include "Resources/ResourceManager.h"
 #include "Tutorial/TutorialSubsystem.h"
 
@@ -195,11 +197,11 @@ bool UCardSubsystem::BuildCardChoice( int32 waveNumber, FCardChoice& outChoice )
 			}
 		}
 
-		availableCards = FCardPoolResolver::Resolve(
+		availableCards = CardPoolResolver_.Resolve(
 			buckets,
-			AppliedCardHistory_,
 			PoolConfig_->CardsToOffer,
 			PoolConfig_->MaxCardsPerRarityInOffering,
+			USessionRandomSubsystem::Stream( GetWorldSafe(), RandomStreams::Cards ),
 			PoolConfig_->MaxStacksForWeightInfluence,
 			seenForWeightReduction,
 			PoolConfig_->RerollSeenWeightMultiplier );
@@ -324,6 +326,11 @@ bool UCardSubsystem::TryRerollCardChoice( int32 waveNumber, int32 rerollIndex, F
 
 	outChoice = tentative;
 
+	if ( UReplaySubsystem* replay = GetGameInstance()->GetSubsystem<UReplaySubsystem>() )
+	{
+		replay->RecordRerollCards( rerollIndex );
+	}
+
 	UE_LOG(
 	    LogCardSubsystem, Log,
 	    TEXT( "Cards rerolled: %d cards offered, paid %d %s (rerollIndex=%d)" ),
@@ -335,6 +342,11 @@ bool UCardSubsystem::TryRerollCardChoice( int32 waveNumber, int32 rerollIndex, F
 
 void UCardSubsystem::ApplySelectedCards( const TArray<UCardDataAsset*>& selectedCards )
 {
+	if ( UReplaySubsystem* replay = GetGameInstance()->GetSubsystem<UReplaySubsystem>() )
+	{
+		replay->RecordApplyCards( selectedCards );
+	}
+
 	if ( PoolConfig_ && selectedCards.Num() > PoolConfig_->CardsToSelect )
 	{
 		UE_LOG(
@@ -428,6 +440,7 @@ void UCardSubsystem::ApplySingleCardOnce(
 		AppliedCardHistory_.Add( FAppliedCardRecord( card, waveNumber ) );
 		newStackCount = 1;
 	}
+	CardPoolResolver_.OnCardApplied( card, newStackCount );
 
 	AcquisitionLog_.Add( card );
 
@@ -746,6 +759,30 @@ void UCardSubsystem::LockCardByID( FName cardID )
 	UE_LOG( LogCardSubsystem, Warning, TEXT( "LockCardByID: '%s' not found in pool" ), *cardID.ToString() );
 }
 
+UCardDataAsset* UCardSubsystem::FindCardByID( FName cardID ) const
+{
+	if ( !PoolConfig_ || cardID.IsNone() )
+	{
+		return nullptr;
+	}
+
+	for ( const TObjectPtr<UCardRarityPoolConfig>& rarityPool : PoolConfig_->RarityPools )
+	{
+		if ( !rarityPool )
+		{
+			continue;
+		}
+		for ( const TObjectPtr<UCardDataAsset>& card : rarityPool->Cards )
+		{
+			if ( card && card->CardID == cardID )
+			{
+				return card.Get();
+			}
+		}
+	}
+	return nullptr;
+}
+
 void UCardSubsystem::ResetUnlocksToDefaults()
 {
 	RuntimeUnlocked_.Empty();
@@ -788,6 +825,7 @@ void UCardSubsystem::ResetCardHistory()
 	InvalidateBuildingTooltipPreviewCache();
 
 	AppliedCardHistory_.Empty();
+	CardPoolResolver_.Reset();
 	AcquisitionLog_.Empty();
 	EconomyBonuses_.Reset();
 	CurrentWaveNumber_ = 0;
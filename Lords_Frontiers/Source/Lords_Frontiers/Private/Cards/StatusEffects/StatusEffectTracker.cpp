@@ -5,8 +5,10 @@
 #include "Cards/StatusEffects/StatusEffectDef.h"
 #include "Cards/Visuals/CardVisualSubsystem.h"
 #include "Components/FollowComponent.h"
+#include "Core/Subsystems/BattlefieldTeardown/BattlefieldTeardownSubsystem.h"
 #include "Entity.h"
 #include "EntityStats.h"
+#include "Utilities/GameplayStats.h"
 
 #include "Engine/World.h"
 
@@ -18,7 +20,16 @@ UStatusEffectTracker::UStatusEffectTracker()
 
 void UStatusEffectTracker::EndPlay( const EEndPlayReason::Type endPlayReason )
 {
-	ClearAll();
+	if ( UBattlefieldTeardownSubsystem::IsBulkTeardown( this ) )
+	{
+		// The owner is going away, so undoing each status is wasted work; sticky visuals are ended in bulk
+		FGameplayPerf::AdjustStatusEffects( -Active_.Num() );
+		Active_.Empty();
+	}
+	else
+	{
+		ClearAll();
+	}
 	Super::EndPlay( endPlayReason );
 }
 
@@ -32,6 +43,8 @@ void UStatusEffectTracker::TickComponent(
 		return;
 	}
 
+	LF_SCOPE_CYCLE_COUNTER( StatusEffects );
+
 	AActor* owner = GetOwner();
 	UWorld* world = GetWorld();
 	if ( !owner || !world )
@@ -89,6 +102,7 @@ void UStatusEffectTracker::TickComponent(
 		}
 		ReleaseStatusVisual( state );
 		Active_.RemoveAt( i );
+		FGameplayPerf::AdjustStatusEffects( -1 );
 		bRemovedAny = true;
 	}
 
@@ -134,6 +148,7 @@ void UStatusEffectTracker::ApplyStatus( UStatusEffectDef* def, AActor* instigato
 	state.Instigator = instigator;
 
 	const int32 idx = Active_.Add( MoveTemp( state ) );
+	FGameplayPerf::AdjustStatusEffects( 1 );
 	def->OnApply( GetOwner(), Active_[idx] );
 
 	if ( UCardVisualSubsystem* visuals = UCardVisualSubsystem::Get( this ) )
@@ -183,6 +198,7 @@ void UStatusEffectTracker::RemoveStatus( UStatusEffectDef* def )
 		}
 		ReleaseStatusVisual( Active_[i] );
 		Active_.RemoveAt( i );
+		FGameplayPerf::AdjustStatusEffects( -1 );
 		bRemovedAny = true;
 	}
 
@@ -203,6 +219,7 @@ void UStatusEffectTracker::ClearAll()
 		}
 		ReleaseStatusVisual( state );
 	}
+	FGameplayPerf::AdjustStatusEffects( -Active_.Num() );
 	Active_.Empty();
 
 	RecomputeStackedModifiers();
@@ -267,35 +284,31 @@ void UStatusEffectTracker::RecomputeStackedModifiers()
 		}
 	}
 
+	// Multiplicative layers on the stat stack: other modifiers keep working while a slow is active.
+	const FStatModifierSource slowSource( this, 0 );
 	if ( slowSum > 0.f )
 	{
-		if ( CachedOriginalMaxSpeed_ < 0.f )
-		{
-			CachedOriginalMaxSpeed_ = stats.MaxSpeed();
-		}
 		const float clamped = FMath::Min( slowSum, slowCap );
-		const float newSpeed = CachedOriginalMaxSpeed_ * ( 1.f - clamped / 100.f );
-		stats.SetMaxSpeed( newSpeed );
+		stats.SetModifier(
+		    EStatsType::MaxSpeed, slowSource, 1.f - clamped / 100.f, EStatModifierLayer::Multiplicative
+		);
 	}
-	else if ( CachedOriginalMaxSpeed_ >= 0.f )
+	else
 	{
-		stats.SetMaxSpeed( CachedOriginalMaxSpeed_ );
-		CachedOriginalMaxSpeed_ = -1.f;
+		stats.RemoveModifier( EStatsType::MaxSpeed, slowSource );
 	}
 
+	const FStatModifierSource attackSlowSource( this, 1 );
 	if ( atkSlowSum > 0.f )
 	{
-		if ( CachedOriginalAttackCooldown_ < 0.f )
-		{
-			CachedOriginalAttackCooldown_ = stats.AttackCooldown();
-		}
 		const float clamped = FMath::Min( atkSlowSum, atkSlowCap );
-		stats.SetAttackCooldown( CachedOriginalAttackCooldown_ * ( 1.f + clamped / 100.f ) );
+		stats.SetModifier(
+		    EStatsType::AttackCooldown, attackSlowSource, 1.f + clamped / 100.f, EStatModifierLayer::Multiplicative
+		);
 	}
-	else if ( CachedOriginalAttackCooldown_ >= 0.f )
+	else
 	{
-		stats.SetAttackCooldown( CachedOriginalAttackCooldown_ );
-		CachedOriginalAttackCooldown_ = -1.f;
+		stats.RemoveModifier( EStatsType::AttackCooldown, attackSlowSource );
 	}
 }
 
@@ -4,6 +4,7 @@
 #include "Cards/Feedback/CardFeedbackPopup.h"
 #include "Cards/Feedback/CardIconStrip.h"
 #include "Core/DefaultGameInstance.h"
+#include "Core/Subsystems/CameraViewSubsystem/CameraViewSubsystem.h"
 
 #include "Components/SkeletalMeshComponent.h"
 #include "Engine/Engine.h"
@@ -122,7 +123,16 @@ bool UCardVisualSubsystem::IsTickable() const
 
 void UCardVisualSubsystem::Tick( float deltaTime )
 {
-	const float zoomAlpha = CameraZoomUtils::GetCameraZoomAlpha( this );
+	const FCameraViewState* viewState = UCameraViewSubsystem::FindState( this );
+	const uint64 zoomGeneration = viewState ? viewState->ZoomGeneration : 0;
+	if ( !bCameraScaleDirty_ && zoomGeneration != 0 && zoomGeneration == AppliedZoomGeneration_ )
+	{
+		return;
+	}
+	AppliedZoomGeneration_ = zoomGeneration;
+	bCameraScaleDirty_ = false;
+
+	const float zoomAlpha = viewState ? viewState->ZoomAlpha : CameraZoomUtils::GetCameraZoomAlpha( this );
 
 	for ( const TObjectPtr<ACardIconStrip>& strip : ActiveStripsList_ )
 	{
@@ -326,6 +336,7 @@ ACardFeedbackPopup* UCardVisualSubsystem::AcquireIconActor()
 		if ( IsValid( pooled ) )
 		{
 			InUseIcons_.Add( pooled );
+			bCameraScaleDirty_ = true;
 			return pooled;
 		}
 	}
@@ -349,6 +360,7 @@ ACardFeedbackPopup* UCardVisualSubsystem::AcquireIconActor()
 
 	fresh->OnPopupFinished.AddUObject( this, &UCardVisualSubsystem::ReleaseIconActor );
 	InUseIcons_.Add( fresh );
+	bCameraScaleDirty_ = true;
 	return fresh;
 }
 
@@ -439,6 +451,7 @@ ACardIconStrip* UCardVisualSubsystem::GetOrCreateStrip( AActor* host )
 
 	strip->ActivateOn( host );
 	ActiveStripsList_.Add( strip );
+	bCameraScaleDirty_ = true;
 	ActiveStripsByHost_.Add( host, strip );
 	return strip;
 }
@@ -7,9 +7,11 @@
 #include "AI/UnitAIManager.h"
 #include "Core/CoreManager.h"
 #include "Core/Subsystems/ProjectilePoolSubsystem/ProjectilePoolSubsystem.h"
+#include "Core/Subsystems/SessionRandom/SessionRandomSubsystem.h"
 #include "Entity.h"
 #include "Projectiles/BaseProjectile.h"
 #include "Units/Unit.h"
+#include "Utilities/GameplayStats.h"
 #include "Utilities/TraceChannelMappings.h"
 
 #include "Components/SphereComponent.h"
@@ -149,6 +151,8 @@ bool UAttackRangedComponent::DidSeeTargetLastTick()
 
 void UAttackRangedComponent::Look()
 {
+	LF_SCOPE_CYCLE_COUNTER( TargetSearch );
+
 	IAttacker* ownerAttacker = GetOwner<IAttacker>();
 	if ( !ownerAttacker )
 	{
@@ -326,7 +330,7 @@ void UAttackRangedComponent::FireExtraProjectile( AActor* target, float damageMu
 	{
 		const FVector toTarget = ( target->GetActorLocation() - owner->GetActorLocation() ).GetSafeNormal2D();
 		const FVector right = FVector::CrossProduct( toTarget, FVector::UpVector ).GetSafeNormal();
-		const float jitter = FMath::FRandRange( -60.f, 60.f );
+		const float jitter = USessionRandomSubsystem::Stream( this, RandomStreams::Attacks ).FRandRange( -60.f, 60.f );
 		spawnOffset += right * jitter;
 	}
 
@@ -391,7 +395,7 @@ void UAttackRangedComponent::FireShrapnel(
 		static_cast<float>( ownerEntity->Stats().AttackDamage() ) * damageMultiplier );
 
 	const float spread = FMath::Clamp( spreadDegrees, 0.f, 360.f );
-	const float baseYaw = FMath::FRandRange( 0.f, 360.f );
+	const float baseYaw = USessionRandomSubsystem::Stream( this, RandomStreams::Attacks ).FRandRange( 0.f, 360.f );
 
 	for ( int32 i = 0; i < count; ++i )
 	{
@@ -462,7 +466,8 @@ void UAttackRangedComponent::FireSingleProjectile( TWeakObjectPtr<AActor> target
 	}
 
 	const int32 critChance = ownerEntity->Stats().CritChance();
-	if ( critChance > 0 && FMath::RandRange( 1, 100 ) <= critChance )
+	FRandomStream& critRandom = USessionRandomSubsystem::Stream( this, RandomStreams::Crits );
+	if ( critChance > 0 && critRandom.RandRange( 1, 100 ) <= critChance )
 	{
 		const float critMultiplier = 1.f + static_cast<float>( ownerEntity->Stats().CritDamageBonus() ) / 100.f;
 		damageFloat *= critMultiplier;
@@ -8,6 +8,7 @@
 #include "AI/TargetBuildingTracker.h"
 #include "AI/UnitAIManager.h"
 #include "Core/CoreManager.h"
+#include "Core/Subsystems/BattlefieldTeardown/BattlefieldTeardownSubsystem.h"
 #include "Grid/GridManager.h"
 
 #include "Kismet/GameplayStatics.h"
@@ -36,7 +37,8 @@ void UEnemyAggressionComponent::EndPlay( const EEndPlayReason::Type endPlayReaso
 {
 	Super::EndPlay( endPlayReason );
 
-	if ( Path_ )
+	// During a bulk teardown the shared path renderer is cleared as a whole.
+	if ( Path_ && !UBattlefieldTeardownSubsystem::IsBulkTeardown( this ) )
 	{
 		Path_->ClearSpline();
 	}
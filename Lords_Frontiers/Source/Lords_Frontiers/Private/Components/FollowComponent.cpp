@@ -4,6 +4,7 @@
 
 #include "AI/UnitAIManager.h"
 #include "Core/CoreManager.h"
+#include "Core/Subsystems/SessionRandom/SessionRandomSubsystem.h"
 #include "Grid/GridManager.h"
 #include "Units/Unit.h"
 
@@ -15,15 +16,17 @@ UFollowComponent::UFollowComponent()
 {
 	PrimaryComponentTick.bCanEverTick = true;
 	PrimaryComponentTick.bStartWithTickEnabled = true;
-
-	SwayPhaseOffset_ = FMath::FRandRange( 0.0f, 2.0f * PI );
-	StreamRandom_ = FRandomStream( FPlatformTime::Cycles64() );
 }
 
 void UFollowComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// Per-unit stream split off the session's movement stream, so spawn order alone decides each unit's jitter.
+	FRandomStream& movementRandom = USessionRandomSubsystem::Stream( this, RandomStreams::Movement );
+	StreamRandom_ = FRandomStream( movementRandom.RandHelper( MAX_int32 ) );
+	SwayPhaseOffset_ = StreamRandom_.FRandRange( 0.0f, 2.0f * PI );
+
 	Unit_ = Cast<AUnit>( GetOwner() );
 
 	if ( const UCoreManager* core = UGameplayStatics::GetGameInstance( GetWorld() )->GetSubsystem<UCoreManager>() )
@@ -76,7 +79,7 @@ void UFollowComponent::TickComponent(
 		}
 	}
 
-	ResolveUnitOnUnwalkableCell();
+	ResolveUnitOnUnwalkableCell( deltaTime );
 }
 
 void UFollowComponent::StartFollowing()
@@ -155,7 +158,7 @@ void UFollowComponent::Sway( float deltaTime )
 	}
 }
 
-void UFollowComponent::ResolveUnitOnUnwalkableCell()
+void UFollowComponent::ResolveUnitOnUnwalkableCell( float deltaTime )
 {
 	if ( !bAvoidUnwalkableCells_ || !Grid_.IsValid() || !Unit_.IsValid() || !CapsuleComponent_.IsValid() )
 	{
@@ -170,15 +173,15 @@ void UFollowComponent::ResolveUnitOnUnwalkableCell()
 	FVector currentCellCenter;
 	Grid_->GetCellWorldCenter( currentCellCoords, currentCellCenter );
 
-	TArray suspectedCoords{
+	const FIntPoint suspectedCoords[] = {
 	    currentCellCoords, currentCellCoords + FIntPoint( 1, 0 ), currentCellCoords + FIntPoint( -1, 0 ),
 	    currentCellCoords + FIntPoint( 0, 1 ), currentCellCoords + FIntPoint( 0, -1 )
 	};
 
-	for ( const auto& cellCoords : suspectedCoords )
+	for ( const FIntPoint& cellCoords : suspectedCoords )
 	{
-		const FGridCell* cell = Grid_->GetCell( cellCoords.X, cellCoords.Y );
-		if ( cell && !cell->bIsWalkable )
+		if ( Grid_->IsValidCoordsFast( cellCoords.X, cellCoords.Y ) &&
+		     !Grid_->IsWalkableFast( cellCoords.X, cellCoords.Y ) )
 		{
 			FVector cellCenter;
 			Grid_->GetCellWorldCenter( cellCoords, cellCenter );
@@ -194,7 +197,7 @@ void UFollowComponent::ResolveUnitOnUnwalkableCell()
 				const float x = cellCenter.X - FMath::Sign( dx ) * cellSize / 2.0f;
 				const FVector targetLocation = { x, location.Y, location.Z };
 				Unit_->SetActorLocation(
-				    FMath::VInterpTo( location, targetLocation, GetWorld()->GetDeltaSeconds(), UnwalkablePushSpeed_ )
+				    FMath::VInterpTo( location, targetLocation, deltaTime, UnwalkablePushSpeed_ )
 				);
 				return;
 			}
@@ -203,7 +206,7 @@ void UFollowComponent::ResolveUnitOnUnwalkableCell()
 				const float y = cellCenter.Y - FMath::Sign( dy ) * cellSize / 2.0f;
 				const FVector targetLocation = { location.X, y, location.Z };
 				Unit_->SetActorLocation(
-				    FMath::VInterpTo( location, targetLocation, GetWorld()->GetDeltaSeconds(), UnwalkablePushSpeed_ )
+				    FMath::VInterpTo( location, targetLocation, deltaTime, UnwalkablePushSpeed_ )
 				);
 				return;
 			}
@@ -3,7 +3,9 @@
 #include "Components/SpawnAbilityComponent.h"
 
 #include "Core/CoreManager.h"
-#include "NiagaraFunctionLibrary.h"
+#include "Core/Subsystems/SessionRandom/SessionRandomSubsystem.h"
+#include "Core/Subsystems/SpawnScheduler/SpawnSchedulerSubsystem.h"
+#include "Core/Subsystems/VFXPoolSubsystem/VFXPoolSubsystem.h"
 #include "Units/Unit.h"
 #include "Units/UnitBuilder.h"
 #include "VFX/EntityVFXConfig.h"
@@ -14,9 +16,9 @@
 
 float USpawnAbilityComponent::TimeUntilGroupSpawnStart() const
 {
-	if ( GetWorld()->GetTimerManager().IsTimerActive( GroupSpawnTimer_ ) )
+	if ( NextGroupTime_ >= 0.0 )
 	{
-		return GetWorld()->GetTimerManager().GetTimerRemaining( GroupSpawnTimer_ );
+		return static_cast<float>( FMath::Max( NextGroupTime_ - GetWorld()->GetTimeSeconds(), 0.0 ) );
 	}
 
 	return -1.0f;
@@ -26,8 +28,7 @@ void USpawnAbilityComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
-	const float stopTime = StopTimeBeforeSpawn_ + UnitSpawnInterval_ * SpawnedCount_;
-	if ( stopTime > GroupSpawnInterval_ )
+	if ( StopTime() > GroupSpawnInterval_ )
 	{
 		UE_LOG(
 		    LogTemp, Error,
@@ -37,128 +38,135 @@ void USpawnAbilityComponent::BeginPlay()
 		return;
 	}
 
-	UnitBuilder_ = NewObject<UUnitBuilder>( this );
-	if ( !IsValid( UnitBuilder_ ) )
+	if ( GroupSpawnInterval_ <= 0.0f )
+	{
+		return;
+	}
+
+	USpawnSchedulerSubsystem* scheduler = GetWorld()->GetSubsystem<USpawnSchedulerSubsystem>();
+	if ( !scheduler )
 	{
 		return;
 	}
 
 	ResolveVFXDefaults();
 
-	GetWorld()->GetTimerManager().SetTimer(
-	    GroupSpawnTimer_, this, &USpawnAbilityComponent::GroupSpawnTick, GroupSpawnInterval_, true
-	);
+	const float phaseOffset = scheduler->RegisterSummoner( this );
+	NextGroupTime_ = GetWorld()->GetTimeSeconds() + GroupSpawnInterval_ + phaseOffset;
 }
 
-void USpawnAbilityComponent::GroupSpawnTick()
+void USpawnAbilityComponent::EndPlay( const EEndPlayReason::Type endPlayReason )
 {
-	if ( auto* unit = GetOwner<AUnit>() )
+	if ( UWorld* world = GetWorld() )
 	{
-		unit->GetOnAudioEvent().Broadcast( { unit->AudioTags().SpawnAbility, unit->GetActorLocation() } );
-	}
-
-	const float stopTime = StopTimeBeforeSpawn_ + UnitSpawnInterval_ * SpawnedCount_;
-	if ( StopWhileSpawning_ && stopTime > 0 )
-	{
-		// Stop owner temporarily
-		StopUnitMovementAndAttack();
-		GetWorld()->GetTimerManager().SetTimer(
-		    MovementTimer_, this, &USpawnAbilityComponent::ResumeUnitMovementAndAttack,
-		    StopTimeBeforeSpawn_ + UnitSpawnInterval_ * SpawnedCount_, false
-		);
-	}
-
-	if ( const AActor* owner = GetOwner() )
-	{
-		if ( ResolvedSpawnAbilityVFX_ )
+		if ( USpawnSchedulerSubsystem* scheduler = world->GetSubsystem<USpawnSchedulerSubsystem>() )
 		{
-			UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-			    GetWorld(), ResolvedSpawnAbilityVFX_, owner->GetActorLocation(), owner->GetActorRotation()
-			);
+			scheduler->UnregisterSummoner( this );
 		}
 	}
+	NextGroupTime_ = -1.0;
+
+	Super::EndPlay( endPlayReason );
+}
 
-	if ( UnitSpawnInterval_ > 0 )
+float USpawnAbilityComponent::StopTime() const
+{
+	return StopTimeBeforeSpawn_ + UnitSpawnInterval_ * SpawnedCount_;
+}
+
+void USpawnAbilityComponent::AdvanceSchedule( const double now, USpawnSchedulerSubsystem& scheduler )
+{
+	if ( NextGroupTime_ >= 0.0 && now >= NextGroupTime_ )
 	{
-		// Start spawning at an interval
-		GetWorld()->GetTimerManager().SetTimer(
-		    UnitSpawnTimer_, this, &USpawnAbilityComponent::UnitSpawnTick, UnitSpawnInterval_, true,
-		    StopTimeBeforeSpawn_
-		);
+		// Keep the cadence of the scheduled time rather than of the frame that noticed it
+		StartGroup( NextGroupTime_ );
+		NextGroupTime_ = FMath::Max( NextGroupTime_ + GroupSpawnInterval_, now );
 	}
-	else
-	{
-		auto spawnAll = [this]()
-		{
-			for ( int i = 0; i < SpawnedCount_; ++i )
-			{
-				ProcessSpawn();
-			}
-		};
 
-		if ( StopTimeBeforeSpawn_ > 0 )
+	while ( UnitsLeft_ > 0 && now >= NextUnitTime_ )
+	{
+		if ( UnitSpawnInterval_ > 0 )
 		{
-			// Spawn delayed
-			GetWorld()->GetTimerManager().SetTimer(
-			    UnitSpawnTimer_, FTimerDelegate::CreateLambda( spawnAll ), StopTimeBeforeSpawn_, false
-			);
+			scheduler.EnqueueSpawn( this, false );
+			--UnitsLeft_;
+			NextUnitTime_ += UnitSpawnInterval_;
 		}
 		else
 		{
-			// Spawn immediately
-			spawnAll();
+			for ( ; UnitsLeft_ > 0; --UnitsLeft_ )
+			{
+				scheduler.EnqueueSpawn( this, SpawnOnlyWhenSeesEnemy_ );
+			}
 		}
 	}
+
+	if ( ResumeTime_ >= 0.0 && now >= ResumeTime_ )
+	{
+		ResumeTime_ = -1.0;
+		ResumeUnitMovementAndAttack();
+	}
 }
 
-void USpawnAbilityComponent::UnitSpawnTick()
+void USpawnAbilityComponent::StartGroup( const double groupTime )
 {
-	static int remaining = SpawnedCount_;
-
-	SpawnUnit();
-	remaining--;
+	if ( auto* unit = GetOwner<AUnit>() )
+	{
+		unit->GetOnAudioEvent().Broadcast( { unit->AudioTags().SpawnAbility, unit->GetActorLocation() } );
+	}
 
-	if ( remaining <= 0 )
+	const float stopTime = StopTime();
+	if ( StopWhileSpawning_ && stopTime > 0 )
 	{
-		GetWorld()->GetTimerManager().ClearTimer( UnitSpawnTimer_ );
-		remaining = SpawnedCount_;
+		// Stop owner temporarily
+		StopUnitMovementAndAttack();
+		ResumeTime_ = groupTime + stopTime;
 	}
-}
 
-void USpawnAbilityComponent::ProcessSpawn() const
-{
-	if ( SpawnOnlyWhenSeesEnemy_ )
+	if ( const AActor* owner = GetOwner() )
 	{
-		const AUnit* unit = GetOwner<AUnit>();
-		if ( unit && unit->AttackTarget().IsValid() )
+		if ( ResolvedSpawnAbilityVFX_ )
 		{
-			SpawnUnit();
+			if ( UVFXPoolSubsystem* vfxPool = GetWorld()->GetSubsystem<UVFXPoolSubsystem>() )
+			{
+				vfxPool->SpawnAtLocation(
+				    ResolvedSpawnAbilityVFX_, owner->GetActorLocation(), owner->GetActorRotation()
+				);
+			}
 		}
 	}
-	else
-	{
-		SpawnUnit();
-	}
+
+	// With an interval minions come one by one, otherwise the whole group at once after the stop delay
+	UnitsLeft_ = SpawnedCount_;
+	NextUnitTime_ = groupTime + StopTimeBeforeSpawn_;
 }
 
-void USpawnAbilityComponent::SpawnUnit() const
+bool USpawnAbilityComponent::SpawnQueuedUnit( UUnitBuilder& builder, const bool bRequireTarget ) const
 {
 	if ( !GetWorld() )
 	{
-		UE_LOG( LogTemp, Error, TEXT( "USpawnAbilityComponent::SpawnUnit: world not found" ) );
-		return;
+		UE_LOG( LogTemp, Error, TEXT( "USpawnAbilityComponent::SpawnQueuedUnit: world not found" ) );
+		return false;
+	}
+
+	if ( bRequireTarget )
+	{
+		const AUnit* unit = GetOwner<AUnit>();
+		if ( !unit || !unit->AttackTarget().IsValid() )
+		{
+			return false;
+		}
 	}
 
-	UnitBuilder_->CreateNewUnit( SpawnedClass_, FindValidTransform() );
+	builder.CreateNewUnit( SpawnedClass_, FindValidTransform( builder ) );
 
 	if ( const auto* coreManager = UGameplayStatics::GetGameInstance( GetWorld() )->GetSubsystem<UCoreManager>() )
 	{
 		if ( const auto* waveManager = coreManager->GetWaveManager() )
 		{
-			UnitBuilder_->ApplyBuff( waveManager->FindBuffForCurrentWave( SpawnedClass_ ) );
+			builder.ApplyBuff( waveManager->FindBuffForCurrentWave( SpawnedClass_ ) );
 		}
 	}
-	UnitBuilder_->SpawnUnitAndFinish();
+	return builder.SpawnUnitAndFinish().IsValid();
 }
 
 void USpawnAbilityComponent::StopUnitMovementAndAttack() const
@@ -181,7 +189,7 @@ void USpawnAbilityComponent::ResumeUnitMovementAndAttack() const
 	}
 }
 
-FTransform USpawnAbilityComponent::FindValidTransform() const
+FTransform USpawnAbilityComponent::FindValidTransform( const UUnitBuilder& builder ) const
 {
 	if ( !GetOwner() )
 	{
@@ -190,16 +198,11 @@ FTransform USpawnAbilityComponent::FindValidTransform() const
 
 	float spawnedCapsuleRadius = 34.f;
 	float spawnedCapsuleHalfHeight = 88.f;
-	if ( SpawnedClass_ )
+	if ( USpawnSchedulerSubsystem* scheduler = GetWorld()->GetSubsystem<USpawnSchedulerSubsystem>() )
 	{
-		if ( const auto* defaultUnit = Cast<AUnit>( SpawnedClass_->GetDefaultObject() ) )
-		{
-			if ( const UCapsuleComponent* capsule = defaultUnit->FindComponentByClass<UCapsuleComponent>() )
-			{
-				spawnedCapsuleRadius = capsule->GetUnscaledCapsuleRadius();
-				spawnedCapsuleHalfHeight = capsule->GetUnscaledCapsuleHalfHeight();
-			}
-		}
+		const FSpawnedUnitClassInfo& classInfo = scheduler->GetClassInfo( SpawnedClass_ );
+		spawnedCapsuleRadius = classInfo.CapsuleRadius;
+		spawnedCapsuleHalfHeight = classInfo.CapsuleHalfHeight;
 	}
 
 	float ownerCapsuleRadius = 34.f;
@@ -212,10 +215,11 @@ FTransform USpawnAbilityComponent::FindValidTransform() const
 	}
 
 	FTransform transform = GetOwner()->GetTransform();
-	const FVector randomDirection = FMath::VRandCone( GetOwner()->GetActorForwardVector(), PI * 0.5f );
+	FRandomStream& spawnRandom = USessionRandomSubsystem::Stream( this, RandomStreams::Spawning );
+	const FVector randomDirection = spawnRandom.VRandCone( GetOwner()->GetActorForwardVector(), PI * 0.5f );
 	transform.AddToTranslation( randomDirection * ( spawnedCapsuleRadius + ownerCapsuleRadius * 1.5f ) );
 
-	return UnitBuilder_->FindNonOverlappingSpawnTransform(
+	return builder.FindNonOverlappingSpawnTransform(
 	    transform, spawnedCapsuleRadius, spawnedCapsuleHalfHeight, 200.f, 24, false
 	);
 }
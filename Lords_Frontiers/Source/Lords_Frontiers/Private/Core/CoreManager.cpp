@@ -163,7 +163,11 @@ void UCoreManager::ResetGameState()
 
 	if ( WaveManager_.IsValid() )
 	{
-		WaveManager_->CancelCurrentWave();
+		// CleanupBattlefield already cancelled the wave at game end; do not walk it again
+		if ( WaveManager_->HasWaveInProgress() )
+		{
+			WaveManager_->CancelCurrentWave();
+		}
 	}
 	else
 	{
@@ -4,6 +4,8 @@
 
 #include "Building/Construction/BuildManager.h"
 #include "Cards/CardSubsystem.h"
+#include "Core/GameSessionController.h"
+#include "Core/Subsystems/Replay/ReplaySubsystem.h"
 #include "Core/Selection/SelectionManagerComponent.h"
 #include "UI/Cards/CardSelectionHUDComponent.h"
 #include "Selectable.h"
@@ -14,6 +16,7 @@
 #include "Engine/World.h"
 #include "InputCoreTypes.h"
 #include "Kismet/GameplayStatics.h"
+#include "Misc/Paths.h"
 
 ADebugPlayerController::ADebugPlayerController()
 {
@@ -265,3 +268,23 @@ void ADebugPlayerController::Card_ResetUnlocks()
 		cards->ResetUnlocksToDefaults();
 	}
 }
+
+void ADebugPlayerController::Sim_Speed( float speed )
+{
+	if ( UGameSessionController* session = GetGameInstance()->GetSubsystem<UGameSessionController>() )
+	{
+		session->SetGameSpeed( speed );
+	}
+}
+
+void ADebugPlayerController::Replay_Play( const FString& path )
+{
+	UReplaySubsystem* replay = UReplaySubsystem::Get( this );
+	if ( !replay )
+	{
+		return;
+	}
+
+	const FString fullPath = FPaths::IsRelative( path ) ? FPaths::ProjectSavedDir() / TEXT( "Replays" ) / path : path;
+	replay->StartPlayback( fullPath );
+}
@@ -11,6 +11,7 @@
 #include "Core/CoreManager.h"
 #include "Core/DefaultGameInstance.h"
 #include "Core/GameLoop/GameLoopRewardHelper.h"
+#include "Core/Subsystems/Replay/ReplaySubsystem.h"
 #include "TimerManager.h"
 #include "Tutorial/TutorialSubsystem.h"
 #include "Waves/WaveManager.h"
@@ -132,6 +133,11 @@ void UGameLoopManager::EndBuildTurn()
 		return;
 	}
 
+	if ( UReplaySubsystem* replay = GetGameInstance()->GetSubsystem<UReplaySubsystem>() )
+	{
+		replay->RecordEndBuildTurn();
+	}
+
 	if ( UTutorialSubsystem* tutorial = UTutorialSubsystem::Get( this ) )
 	{
 		tutorial->NotifyEndTurnPressed();
@@ -160,6 +166,11 @@ void UGameLoopManager::StartCombatEarly()
 		return;
 	}
 
+	if ( UReplaySubsystem* replay = GetGameInstance()->GetSubsystem<UReplaySubsystem>() )
+	{
+		replay->RecordStartCombatEarly();
+	}
+
 	Log( TEXT( "Starting combat EARLY" ) );
 
 	EnterCombatPhase();
@@ -8,6 +8,7 @@
 #include "Core/GameLoop/GameLoopConfig.h"
 #include "Core/GameLoop/GameLoopManager.h"
 #include "Core/GameSessionController.h"
+#include "Core/Subsystems/VFXPoolSubsystem/VFXPoolSubsystem.h"
 #include "Grid/GridManager.h"
 #include "Lords_Frontiers/Public/Match/MatchResultsWidget.h"
 #include "Lords_Frontiers/Public/Match/MatchScoringConfig.h"
@@ -40,6 +41,14 @@ void AMainGameMode::StartPlay()
 	{
 		Pool->PreWarmPools( ProjectilePoolConfigs );
 	}
+
+	if ( EntityVFXConfig )
+	{
+		if ( UVFXPoolSubsystem* vfxPool = GetWorld()->GetSubsystem<UVFXPoolSubsystem>() )
+		{
+			vfxPool->PreWarmFromConfig( *EntityVFXConfig );
+		}
+	}
 }
 
 void AMainGameMode::InitializeGameSystems()
@@ -2,16 +2,28 @@
 
 #include "Core/GameSessionController.h"
 
+#include "AI/Path/PathPointsManager.h"
+#include "AI/Path/SplinePointConnector.h"
+#include "AI/UnitAIManager.h"
+#include "Cards/Visuals/CardVisualSubsystem.h"
 #include "Core/CoreManager.h"
 #include "Core/DefaultGameInstance.h"
 #include "Core/GameLoop/GameLoopManager.h"
 #include "Core/Saving/GameSaveData.h"
 #include "Core/Saving/GameSaver.h"
+#include "Core/Subsystems/BattlefieldTeardown/BattlefieldTeardownSubsystem.h"
+#include "Core/Subsystems/FixedStepSimulation/FixedStepSimulationSubsystem.h"
+#include "Core/Subsystems/HealthBarPoolSubsystem/HealthBarPoolSubsystem.h"
 #include "Core/Subsystems/LevelSubsystem/LevelSubsystem.h"
+#include "Core/Subsystems/ProjectilePoolSubsystem/ProjectilePoolSubsystem.h"
+#include "Core/Subsystems/Replay/ReplaySubsystem.h"
 #include "Core/Subsystems/SessionLogger/SessionLoggerSubsystem.h"
+#include "Core/Subsystems/UnitSignificanceSubsystem/UnitSignificanceSubsystem.h"
 #include "Engine/World.h"
+#include "EngineUtils.h"
 #include "GameFramework/Controller.h"
 #include "Kismet/GameplayStatics.h"
+#include "Misc/ScopeExit.h"
 #include "EntityStats.h"
 #include "Lords_Frontiers/Public/Match/MatchScoringConfig.h"
 #include "Lords_Frontiers/Public/Match/MatchStatsTracker.h"
@@ -194,23 +206,46 @@ void UGameSessionController::CleanupBattlefield()
 		return;
 	}
 
-	TArray<AActor*> waveManagers;
-	UGameplayStatics::GetAllActorsOfClass( world, AWaveManager::StaticClass(), waveManagers );
-	for ( AActor* a : waveManagers )
+	// Units skip their per-actor unregistration while this is set; registries are cleared below in one pass.
+	UBattlefieldTeardownSubsystem* teardown = world->GetSubsystem<UBattlefieldTeardownSubsystem>();
+	if ( teardown )
 	{
-		if ( AWaveManager* wm = Cast<AWaveManager>( a ) )
+		teardown->SetBulkTeardown( true );
+	}
+	ON_SCOPE_EXIT
+	{
+		if ( teardown )
 		{
-			wm->CancelCurrentWave();
+			teardown->SetBulkTeardown( false );
+		}
+	};
+
+	// Enemy paths go away together, so drop every shared path section and path point at once.
+	if ( const UCoreManager* core = UCoreManager::Get( this ) )
+	{
+		if ( AUnitAIManager* unitAIManager = core->GetUnitAIManager() )
+		{
+			if ( ASplinePointConnector* pathRenderer = unitAIManager->PathRenderer() )
+			{
+				pathRenderer->Clear();
+			}
+			if ( UPathPointsManager* pathPoints = unitAIManager->PathPointsManager() )
+			{
+				pathPoints->Empty();
+			}
 		}
 	}
 
-	TArray<AActor*> units;
-	UGameplayStatics::GetAllActorsOfClass( world, AUnit::StaticClass(), units );
+	for ( TActorIterator<AWaveManager> it( world ); it; ++it )
+	{
+		it->CancelCurrentWave();
+	}
+
 	int32 destroyed = 0;
-	for ( AActor* a : units )
+	for ( TActorIterator<AUnit> it( world ); it; ++it )
 	{
-		AUnit* unit = Cast<AUnit>( a );
-		if ( !unit || unit->Team() != ETeam::Dog )
+		AUnit* unit = *it;
+		if ( unit->Team() != ETeam::Dog || unit->IsActorBeingDestroyed() )
 		{
 			continue;
 		}
@@ -229,6 +264,29 @@ void UGameSessionController::CleanupBattlefield()
 		unit->Destroy();
 		++destroyed;
 	}
+
+	// Status trackers of the destroyed units left their sticky visuals running
+	if ( UCardVisualSubsystem* visuals = UCardVisualSubsystem::Get( this ) )
+	{
+		visuals->EndAllSticky();
+	}
+	if ( USessionLoggerSubsystem* logger = world->GetSubsystem<USessionLoggerSubsystem>() )
+	{
+		logger->ClearEnemyTracking();
+	}
+	if ( UProjectilePoolSubsystem* projectilePool = world->GetSubsystem<UProjectilePoolSubsystem>() )
+	{
+		projectilePool->ReturnAllActive();
+	}
+	if ( UHealthBarPoolSubsystem* healthBars = world->GetSubsystem<UHealthBarPoolSubsystem>() )
+	{
+		healthBars->ReleaseStaleBars();
+	}
+	if ( UUnitSignificanceSubsystem* significance = world->GetSubsystem<UUnitSignificanceSubsystem>() )
+	{
+		significance->RemoveStaleUnits();
+	}
+
 	UE_LOG( LogTemp, Log, TEXT( "GameSessionController: cleanup destroyed %d enemy units." ), destroyed );
 }
 
@@ -266,16 +324,43 @@ void UGameSessionController::ResumeGame()
 
 void UGameSessionController::SetTimerScale( float newTimeScale )
 {
-	if ( UWorld* world = GetWorld() )
+	UWorld* world = GetWorld();
+	if ( !world )
 	{
-		world->GetWorldSettings()->SetTimeDilation( newTimeScale );
+		return;
+	}
+
+	// Replay playback runs at the top fast-forward speed whatever the recorded speed was.
+	const UReplaySubsystem* replay = GetGameInstance()->GetSubsystem<UReplaySubsystem>();
+	if ( replay && replay->IsPlayingBack() )
+	{
+		newTimeScale = UFixedStepSimulationSubsystem::cMaxSpeed;
+	}
+
+	// Large time dilation makes every tick a huge step; above it the game is stepped at a fixed rate instead.
+	UFixedStepSimulationSubsystem* fixedStep = world->GetSubsystem<UFixedStepSimulationSubsystem>();
+	if ( fixedStep && newTimeScale > UFixedStepSimulationSubsystem::cMaxDilatedSpeed )
+	{
+		fixedStep->Start( newTimeScale );
+		return;
+	}
+
+	if ( fixedStep )
+	{
+		fixedStep->Stop();
 	}
+	world->GetWorldSettings()->SetTimeDilation( newTimeScale );
 }
 
 float UGameSessionController::GetTimerScale() const
 {
 	if ( UWorld* world = GetWorld() )
 	{
+		const UFixedStepSimulationSubsystem* fixedStep = world->GetSubsystem<UFixedStepSimulationSubsystem>();
+		if ( fixedStep && fixedStep->IsActive() )
+		{
+			return fixedStep->GetTargetSpeed();
+		}
 		return world->GetWorldSettings()->GetEffectiveTimeDilation();
 	}
 	return 1.0f;
@@ -319,7 +404,7 @@ void UGameSessionController::HandlePhaseChanged( EGameLoopPhase oldPhase, EGameL
 	}
 	else if ( newPhase == EGameLoopPhase::Combat && oldPhase != EGameLoopPhase::Combat )
 	{
-		SetGameSpeed( LastCombatSpeed_ );
+		ApplyGameSpeed( LastCombatSpeed_ );
 	}
 }
 
@@ -342,6 +427,11 @@ void UGameSessionController::CycleSpeed()
 		next = 8.0f;
 	}
 
+	if ( UReplaySubsystem* replay = GetGameInstance()->GetSubsystem<UReplaySubsystem>() )
+	{
+		replay->RecordSetSpeed( next );
+	}
+
 	SetTimerScale( next );
 	OnSpeedChanged.Broadcast( next );
 }
@@ -353,7 +443,22 @@ void UGameSessionController::SetGameSpeed( float newSpeed )
 		return;
 	}
 
-	const float clamped = FMath::Max( newSpeed, 0.0f );
+	if ( UReplaySubsystem* replay = GetGameInstance()->GetSubsystem<UReplaySubsystem>() )
+	{
+		replay->RecordSetSpeed( newSpeed );
+	}
+
+	ApplyGameSpeed( newSpeed );
+}
+
+void UGameSessionController::ApplyGameSpeed( const float newSpeed )
+{
+	if ( !GameLoopManager_ || GameLoopManager_->GetCurrentPhase() != EGameLoopPhase::Combat )
+	{
+		return;
+	}
+
+	const float clamped = FMath::Clamp( newSpeed, 0.0f, UFixedStepSimulationSubsystem::cMaxSpeed );
 	SetTimerScale( clamped );
 	OnSpeedChanged.Broadcast( clamped );
 
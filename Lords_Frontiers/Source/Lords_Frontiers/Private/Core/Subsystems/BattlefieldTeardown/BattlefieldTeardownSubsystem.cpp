@@ -0,0 +1,21 @@
+#include "Core/Subsystems/BattlefieldTeardown/BattlefieldTeardownSubsystem.h"
+
+#include "Engine/World.h"
+
+bool UBattlefieldTeardownSubsystem::ShouldCreateSubsystem( UObject* outer ) const
+{
+	const UWorld* world = Cast<UWorld>( outer );
+	return world && world->IsGameWorld() && Super::ShouldCreateSubsystem( outer );
+}
+
+bool UBattlefieldTeardownSubsystem::IsBulkTeardown( const UObject* worldContextObject )
+{
+	const UWorld* world = worldContextObject ? worldContextObject->GetWorld() : nullptr;
+	if ( !world )
+	{
+		return false;
+	}
+
+	const UBattlefieldTeardownSubsystem* teardown = world->GetSubsystem<UBattlefieldTeardownSubsystem>();
+	return teardown && teardown->bBulkTeardown_;
+}
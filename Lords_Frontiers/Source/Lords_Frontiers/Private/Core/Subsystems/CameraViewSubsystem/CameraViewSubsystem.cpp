@@ -0,0 +1,61 @@
+#include "Core/Subsystems/CameraViewSubsystem/CameraViewSubsystem.h"
+
+#include "Camera/CameraZoomUtils.h"
+#include "Camera/StrategyCamera.h"
+
+#include "Engine/GameViewportClient.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "SceneManagement.h"
+
+const FCameraViewState* UCameraViewSubsystem::FindState( const UObject* worldContextObject )
+{
+	const UWorld* world = worldContextObject ? worldContextObject->GetWorld() : nullptr;
+	const UCameraViewSubsystem* subsystem = world ? world->GetSubsystem<UCameraViewSubsystem>() : nullptr;
+	if ( !subsystem || !subsystem->HasPublished() )
+	{
+		return nullptr;
+	}
+	return &subsystem->GetState();
+}
+
+void UCameraViewSubsystem::Publish( const AStrategyCamera& camera )
+{
+	const float zoomAlpha = CameraZoomUtils::ComputeZoomAlpha( camera );
+	if ( State_.ZoomGeneration == 0 || !FMath::IsNearlyEqual( zoomAlpha, State_.ZoomAlpha, 1.e-4f ) )
+	{
+		State_.ZoomAlpha = zoomAlpha;
+		++State_.ZoomGeneration;
+	}
+
+	const APlayerController* pc = Cast<APlayerController>( camera.GetController() );
+	const ULocalPlayer* localPlayer = pc ? pc->GetLocalPlayer() : nullptr;
+	if ( !localPlayer || !localPlayer->ViewportClient || !localPlayer->ViewportClient->Viewport )
+	{
+		State_.bHasView = false;
+		return;
+	}
+
+	// Same projection data APlayerController::ProjectWorldLocationToScreen uses.
+	FSceneViewProjectionData projectionData;
+	if ( !localPlayer->GetProjectionData( localPlayer->ViewportClient->Viewport, projectionData ) )
+	{
+		State_.bHasView = false;
+		return;
+	}
+
+	const FMatrix viewProjection = projectionData.ComputeViewProjectionMatrix();
+	const FIntRect viewRect = projectionData.GetConstrainedViewRect();
+
+	if ( !State_.bHasView || viewRect != State_.ViewRect ||
+	     !viewProjection.Equals( State_.ViewProjectionMatrix, KINDA_SMALL_NUMBER ) )
+	{
+		State_.ViewProjectionMatrix = viewProjection;
+		State_.ViewRect = viewRect;
+		GetViewFrustumBounds( State_.Frustum, viewProjection, false );
+		++State_.ViewGeneration;
+	}
+
+	State_.bHasView = true;
+}
@@ -0,0 +1,188 @@
+#include "Core/Subsystems/FixedStepSimulation/FixedStepSimulationSubsystem.h"
+
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/WorldSettings.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CoreDelegates.h"
+
+namespace
+{
+	// Wall time the extra steps may take per engine frame, so input and the HUD keep a usable frame rate
+	constexpr double cStepBudgetSeconds = 1.0 / 20.0;
+
+	// Owing more steps than this many frames' worth stops the loop from trying to catch up
+	constexpr double cMaxStepDebt = 4.0 * UFixedStepSimulationSubsystem::cMaxSpeed;
+
+	constexpr float cEffectiveSpeedSmoothing = 0.05f;
+
+	// Player controllers (input processing) and their pawns (the strategy camera) run on real frame time, so they
+	// keep to the engine's own world tick: an extra step would re-fire held input and move the camera again.
+	void SuspendPlayerTicks( UWorld& world, TArray<TWeakObjectPtr<AActor>, TInlineAllocator<4>>& outSuspended )
+	{
+		for ( FConstPlayerControllerIterator it = world.GetPlayerControllerIterator(); it; ++it )
+		{
+			APlayerController* controller = it->Get();
+			if ( !controller )
+			{
+				continue;
+			}
+
+			AActor* const playerActors[] = { controller, controller->GetPawn() };
+			for ( AActor* actor : playerActors )
+			{
+				if ( actor && actor->IsActorTickEnabled() )
+				{
+					actor->SetActorTickEnabled( false );
+					outSuspended.Add( actor );
+				}
+			}
+		}
+	}
+}
+
+TStatId UFixedStepSimulationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT( UFixedStepSimulationSubsystem, STATGROUP_Tickables );
+}
+
+void UFixedStepSimulationSubsystem::Deinitialize()
+{
+	Stop();
+	Super::Deinitialize();
+}
+
+void UFixedStepSimulationSubsystem::Start( const float speed )
+{
+	TargetSpeed_ = FMath::Clamp( speed, 1.0f, cMaxSpeed );
+
+	if ( bActive_ )
+	{
+		return;
+	}
+
+	UWorld* world = GetWorld();
+	AWorldSettings* worldSettings = world ? world->GetWorldSettings() : nullptr;
+	if ( !worldSettings )
+	{
+		return;
+	}
+
+	bActive_ = true;
+	EffectiveSpeed_ = TargetSpeed_;
+	StepDebt_ = 0.0;
+	LastFrameWallTime_ = FPlatformTime::Seconds();
+
+	// Speed comes from the number of ticks now, every tick is exactly one step.
+	PrevMinUndilatedFrameTime_ = worldSettings->MinUndilatedFrameTime;
+	PrevMaxUndilatedFrameTime_ = worldSettings->MaxUndilatedFrameTime;
+	worldSettings->MinUndilatedFrameTime = static_cast<float>( cStepSeconds );
+	worldSettings->MaxUndilatedFrameTime = static_cast<float>( cStepSeconds );
+	worldSettings->SetTimeDilation( 1.0f );
+
+	EndFrameHandle_ = FCoreDelegates::OnEndFrame.AddUObject( this, &UFixedStepSimulationSubsystem::HandleEndFrame );
+
+	UE_LOG(
+	    LogTemp, Log, TEXT( "FixedStepSimulation: started at %.0fx, step %.1f ms" ), TargetSpeed_,
+	    cStepSeconds * 1000.0
+	);
+}
+
+void UFixedStepSimulationSubsystem::Stop()
+{
+	if ( !bActive_ )
+	{
+		return;
+	}
+
+	bActive_ = false;
+	FCoreDelegates::OnEndFrame.Remove( EndFrameHandle_ );
+	EndFrameHandle_.Reset();
+
+	const UWorld* world = GetWorld();
+	if ( AWorldSettings* worldSettings = world ? world->GetWorldSettings() : nullptr )
+	{
+		worldSettings->MinUndilatedFrameTime = PrevMinUndilatedFrameTime_;
+		worldSettings->MaxUndilatedFrameTime = PrevMaxUndilatedFrameTime_;
+	}
+
+	UE_LOG( LogTemp, Log, TEXT( "FixedStepSimulation: stopped after %llu steps" ), StepCount_ );
+}
+
+void UFixedStepSimulationSubsystem::Tick( float deltaTime )
+{
+	// Runs inside every world tick, the engine's own and the extra ones alike
+	++StepCount_;
+}
+
+void UFixedStepSimulationSubsystem::HandleEndFrame()
+{
+	UWorld* world = GetWorld();
+	if ( !bActive_ || bInExtraSteps_ || !world || world->bIsTearingDown )
+	{
+		return;
+	}
+
+	const double frameStart = FPlatformTime::Seconds();
+	const double wallDelta = frameStart - LastFrameWallTime_;
+	LastFrameWallTime_ = frameStart;
+
+	if ( world->IsPaused() )
+	{
+		StepDebt_ = 0.0;
+		return;
+	}
+
+	// The engine frame already ran one step
+	StepDebt_ += wallDelta * TargetSpeed_ / cStepSeconds - 1.0;
+	if ( StepDebt_ > cMaxStepDebt )
+	{
+		// Over budget: run as fast as frames allow instead of bursting to catch up.
+		StepDebt_ = cMaxStepDebt;
+	}
+
+	int32 steps = 1;
+	if ( StepDebt_ >= 1.0 )
+	{
+		TGuardValue<bool> inExtraSteps( bInExtraSteps_, true );
+
+		// Outside the engine's world loop nothing has switched to this world; do what it would (GWorld, PIE instance)
+		UWorld* const previousGWorld = GWorld;
+		GWorld = world;
+#if WITH_EDITOR
+		const FWorldContext* context = GEngine ? GEngine->GetWorldContextFromWorld( world ) : nullptr;
+		TGuardValue<int32> playInEditorId( GPlayInEditorID, context ? context->PIEInstance : GPlayInEditorID );
+#endif
+
+		TArray<TWeakObjectPtr<AActor>, TInlineAllocator<4>> suspended;
+		SuspendPlayerTicks( *world, suspended );
+
+		while ( StepDebt_ >= 1.0 && FPlatformTime::Seconds() - frameStart < cStepBudgetSeconds )
+		{
+			world->Tick( LEVELTICK_All, static_cast<float>( cStepSeconds ) );
+			StepDebt_ -= 1.0;
+			++steps;
+		}
+
+		for ( const TWeakObjectPtr<AActor>& actor : suspended )
+		{
+			if ( actor.IsValid() )
+			{
+				actor->SetActorTickEnabled( true );
+			}
+		}
+
+		GWorld = previousGWorld;
+	}
+
+	// Ahead of the target (the frame itself stepped too much) is not owed back
+	StepDebt_ = FMath::Max( StepDebt_, 0.0 );
+
+	if ( wallDelta > 0.0 )
+	{
+		const float instant = static_cast<float>( steps * cStepSeconds / wallDelta );
+		EffectiveSpeed_ = FMath::Lerp( EffectiveSpeed_, FMath::Min( instant, cMaxSpeed ), cEffectiveSpeedSmoothing );
+	}
+}
@@ -2,6 +2,7 @@
 
 #include "Building/Building.h"
 #include "Camera/CameraZoomUtils.h"
+#include "Core/Subsystems/CameraViewSubsystem/CameraViewSubsystem.h"
 #include "Entity.h"
 #include "UI/GameHUD.h"
 #include "UI/HealthBar/HealthBarConfigDataAsset.h"
@@ -22,11 +23,13 @@ void UHealthBarPoolSubsystem::Initialize( FSubsystemCollectionBase& collection )
 
 void UHealthBarPoolSubsystem::Deinitialize()
 {
-	for ( TPair<TWeakObjectPtr<AActor>, FActiveHealthBar>& pair : ActiveBars_ )
+	for ( FActiveHealthBar& bar : Bars_ )
 	{
-		DetachBar( pair.Value );
+		DetachBar( bar );
 	}
-	ActiveBars_.Empty();
+	Bars_.Empty();
+	BarIndexByEntity_.Empty();
+	OutstandingWidgets_ = 0;
 	Pools_.Empty();
 	WarmedClasses_.Empty();
 	LastDisplayedPercent_.Empty();
@@ -41,7 +44,7 @@ TStatId UHealthBarPoolSubsystem::GetStatId() const
 
 bool UHealthBarPoolSubsystem::IsTickable() const
 {
-	return ActiveBars_.Num() > 0;
+	return Bars_.Num() > 0;
 }
 
 int32 UHealthBarPoolSubsystem::GetPooledCount( TSubclassOf<UHealthBarWidget> widgetClass ) const
@@ -82,6 +85,31 @@ void UHealthBarPoolSubsystem::PreWarm( TSubclassOf<UHealthBarWidget> widgetClass
 	WarmedClasses_.Add( widgetClass );
 }
 
+void UHealthBarPoolSubsystem::PreWarmFor( AActor* entity, UHealthBarConfigDataAsset* config )
+{
+	if ( !entity || !config )
+	{
+		return;
+	}
+
+	if ( const TSubclassOf<UHealthBarWidget> widgetClass = ResolveWidgetClass( entity, config ) )
+	{
+		WarmClass( widgetClass, *config );
+	}
+}
+
+void UHealthBarPoolSubsystem::WarmClass(
+    const TSubclassOf<UHealthBarWidget> widgetClass, const UHealthBarConfigDataAsset& config
+)
+{
+	if ( !WarmedClasses_.Contains( widgetClass ) )
+	{
+		CachedPoolSize_ = FMath::Max( 0, config.PoolSize_ );
+		CachedHideDelay_ = config.HideDelay_;
+		PreWarm( widgetClass, CachedPoolSize_ );
+	}
+}
+
 TSubclassOf<UHealthBarWidget> UHealthBarPoolSubsystem::ResolveWidgetClass(
     AActor* entity, UHealthBarConfigDataAsset* config
 ) const
@@ -137,12 +165,7 @@ void UHealthBarPoolSubsystem::ShowFor( AActor* entity, UHealthBarConfigDataAsset
 		return;
 	}
 
-	if ( !WarmedClasses_.Contains( widgetClass ) )
-	{
-		CachedPoolSize_ = FMath::Max( 0, config->PoolSize_ );
-		CachedHideDelay_ = config->HideDelay_;
-		PreWarm( widgetClass, CachedPoolSize_ );
-	}
+	WarmClass( widgetClass, *config );
 
 	IEntity* entityInterface = Cast<IEntity>( entity );
 	if ( !entityInterface )
@@ -154,17 +177,16 @@ void UHealthBarPoolSubsystem::ShowFor( AActor* entity, UHealthBarConfigDataAsset
 	const bool bIsBossEntity = IsBoss( entity );
 	const bool bAtFullHealth = stats.IsAtFullHealth();
 
-	if ( FActiveHealthBar* existing = ActiveBars_.Find( entity ) )
+	if ( const int32* existingIndex = BarIndexByEntity_.Find( entity ) )
 	{
+		// Coalesced: the widget is written once per frame in Tick, however many hits landed.
+		FActiveHealthBar& existing = Bars_[*existingIndex];
 		if ( !bAtFullHealth || bIsBossEntity )
 		{
-			existing->HideTimer = config->HideDelay_;
-			existing->TouchOrder = ++TouchCounter_;
-		}
-		if ( existing->Widget )
-		{
-			existing->Widget->SetHealth( stats.Health(), stats.MaxHealth() );
+			existing.HideTimer = config->HideDelay_;
+			existing.TouchOrder = ++TouchCounter_;
 		}
+		existing.bHealthDirty = true;
 		return;
 	}
 
@@ -181,6 +203,7 @@ void UHealthBarPoolSubsystem::ShowFor( AActor* entity, UHealthBarConfigDataAsset
 
 	FActiveHealthBar bar;
 	bar.Entity = entity;
+	bar.EntityKey = entity;
 	bar.Widget = widget;
 	bar.Config = config;
 	bar.bIsBoss = bIsBossEntity;
@@ -200,10 +223,10 @@ void UHealthBarPoolSubsystem::ShowFor( AActor* entity, UHealthBarConfigDataAsset
 		AttachWorldBar( bar, widget );
 	}
 
-	if ( const float* savedPercent = LastDisplayedPercent_.Find( entity ) )
+	float savedPercent = 0.0f;
+	if ( LastDisplayedPercent_.RemoveAndCopyValue( entity, savedPercent ) )
 	{
-		widget->ResetTo( *savedPercent );
-		LastDisplayedPercent_.Remove( entity );
+		widget->ResetTo( savedPercent );
 	}
 	else
 	{
@@ -214,7 +237,7 @@ void UHealthBarPoolSubsystem::ShowFor( AActor* entity, UHealthBarConfigDataAsset
 	widget->SetVisibility( ESlateVisibility::SelfHitTestInvisible );
 	widget->OnShow();
 
-	ActiveBars_.Add( entity, bar );
+	BarIndexByEntity_.Add( entity, Bars_.Add( bar ) );
 }
 
 void UHealthBarPoolSubsystem::HideFor( AActor* entity )
@@ -224,20 +247,53 @@ void UHealthBarPoolSubsystem::HideFor( AActor* entity )
 		return;
 	}
 
-	FActiveHealthBar bar;
-	if ( !ActiveBars_.RemoveAndCopyValue( entity, bar ) )
+	if ( const int32* index = BarIndexByEntity_.Find( entity ) )
 	{
-		return;
+		RemoveBarAt( *index );
 	}
+}
 
-	if ( bar.Widget )
+void UHealthBarPoolSubsystem::ReleaseStaleBars()
+{
+	for ( int32 i = Bars_.Num() - 1; i >= 0; --i )
+	{
+		if ( !Bars_[i].Entity.IsValid() )
+		{
+			RemoveBarAt( i );
+		}
+	}
+
+	for ( auto it = LastDisplayedPercent_.CreateIterator(); it; ++it )
+	{
+		if ( !it.Key().ResolveObjectPtr() )
+		{
+			it.RemoveCurrent();
+		}
+	}
+}
+
+void UHealthBarPoolSubsystem::RemoveBarAt( const int32 index )
+{
+	FActiveHealthBar bar = Bars_[index];
+
+	const int32 last = Bars_.Num() - 1;
+	BarIndexByEntity_.Remove( bar.EntityKey );
+	Bars_.RemoveAtSwap( index, EAllowShrinking::No );
+	if ( index != last )
+	{
+		BarIndexByEntity_.Add( Bars_[index].EntityKey, index );
+	}
+
+	AActor* entity = bar.Entity.Get();
+	if ( entity )
 	{
 		bool bRememberPercent = true;
 		if ( const IEntity* entityInterface = Cast<IEntity>( entity ) )
 		{
 			bRememberPercent = entityInterface->Stats().IsAlive();
 		}
-		if ( bRememberPercent )
+
+		if ( bRememberPercent && bar.Widget )
 		{
 			LastDisplayedPercent_.Add( entity, bar.Widget->GetDisplayedPercent() );
 		}
@@ -245,6 +301,10 @@ void UHealthBarPoolSubsystem::HideFor( AActor* entity )
 		{
 			LastDisplayedPercent_.Remove( entity );
 		}
+	}
+
+	if ( bar.Widget )
+	{
 		bar.Widget->OnHide();
 	}
 
@@ -256,7 +316,9 @@ void UHealthBarPoolSubsystem::HideFor( AActor* entity )
 	}
 }
 
-UHealthBarWidget* UHealthBarPoolSubsystem::AcquireWidget( TSubclassOf<UHealthBarWidget> widgetClass )
+UHealthBarWidget* UHealthBarPoolSubsystem::AcquireWidget(
+    TSubclassOf<UHealthBarWidget> widgetClass, const bool bAllowEviction
+)
 {
 	FHealthBarPool& pool = Pools_.FindOrAdd( widgetClass );
 
@@ -265,14 +327,16 @@ UHealthBarWidget* UHealthBarPoolSubsystem::AcquireWidget( TSubclassOf<UHealthBar
 		UHealthBarWidget* candidate = pool.FreeWidgets.Pop( EAllowShrinking::No );
 		if ( IsValid( candidate ) )
 		{
+			++OutstandingWidgets_;
 			return candidate;
 		}
 	}
 
-	if ( ActiveBars_.Num() >= CachedPoolSize_ && CachedPoolSize_ > 0 )
+	if ( bAllowEviction && OutstandingWidgets_ >= CachedPoolSize_ && CachedPoolSize_ > 0 )
 	{
 		if ( UHealthBarWidget* recycled = EvictOldest( widgetClass ) )
 		{
+			++OutstandingWidgets_;
 			return recycled;
 		}
 	}
@@ -286,35 +350,36 @@ UHealthBarWidget* UHealthBarPoolSubsystem::AcquireWidget( TSubclassOf<UHealthBar
 	if ( fresh )
 	{
 		fresh->SetVisibility( ESlateVisibility::Collapsed );
+		++OutstandingWidgets_;
 	}
 	return fresh;
 }
 
 UHealthBarWidget* UHealthBarPoolSubsystem::EvictOldest( TSubclassOf<UHealthBarWidget> widgetClass )
 {
-	TWeakObjectPtr<AActor> oldestKey;
+	int32 oldestIndex = INDEX_NONE;
 	uint64 oldestOrder = TNumericLimits<uint64>::Max();
 
-	for ( const TPair<TWeakObjectPtr<AActor>, FActiveHealthBar>& pair : ActiveBars_ )
+	for ( int32 i = 0; i < Bars_.Num(); ++i )
 	{
-		if ( pair.Value.bIsBoss )
+		const FActiveHealthBar& bar = Bars_[i];
+		if ( bar.bIsBoss || !bar.Widget )
 		{
 			continue;
 		}
-		if ( pair.Value.TouchOrder < oldestOrder )
+		if ( bar.TouchOrder < oldestOrder )
 		{
-			oldestOrder = pair.Value.TouchOrder;
-			oldestKey = pair.Key;
+			oldestOrder = bar.TouchOrder;
+			oldestIndex = i;
 		}
 	}
 
-	if ( !oldestKey.IsValid() )
+	if ( oldestIndex == INDEX_NONE )
 	{
 		return nullptr;
 	}
 
-	AActor* victimEntity = oldestKey.Get();
-	HideFor( victimEntity );
+	RemoveBarAt( oldestIndex );
 
 	FHealthBarPool& pool = Pools_.FindOrAdd( widgetClass );
 	while ( pool.FreeWidgets.Num() > 0 )
@@ -337,6 +402,7 @@ void UHealthBarPoolSubsystem::ReleaseWidget( UHealthBarWidget* widget )
 
 	widget->SetVisibility( ESlateVisibility::Collapsed );
 	widget->SetRenderTransform( FWidgetTransform() );
+	OutstandingWidgets_ = FMath::Max( 0, OutstandingWidgets_ - 1 );
 
 	const TSubclassOf<UHealthBarWidget> cls = widget->GetClass();
 	Pools_.FindOrAdd( cls ).FreeWidgets.Add( widget );
@@ -413,36 +479,167 @@ UGameHUDWidget* UHealthBarPoolSubsystem::ResolveHUD() const
 
 void UHealthBarPoolSubsystem::Tick( float deltaTime )
 {
-	const float zoomAlpha = CameraZoomUtils::GetCameraZoomAlpha( this );
+	const FCameraViewState* viewState = UCameraViewSubsystem::FindState( this );
+	const float zoomAlpha = viewState ? viewState->ZoomAlpha : CameraZoomUtils::GetCameraZoomAlpha( this );
+	const uint64 zoomGeneration = viewState ? viewState->ZoomGeneration : 0;
+	const bool bCanLod = viewState && viewState->bHasView;
 
-	TArray<AActor*> expired;
-	for ( TPair<TWeakObjectPtr<AActor>, FActiveHealthBar>& pair : ActiveBars_ )
+	TArray<int32, TInlineAllocator<16>> expired;
+	for ( int32 i = 0; i < Bars_.Num(); ++i )
 	{
-		FActiveHealthBar& bar = pair.Value;
-		if ( !bar.Entity.IsValid() )
+		FActiveHealthBar& bar = Bars_[i];
+		AActor* entity = bar.Entity.Get();
+		if ( !entity )
 		{
-			expired.Add( pair.Key.Get() );
+			expired.Add( i );
 			continue;
 		}
 
-		if ( bar.Widget )
-		{
-			bar.Widget->TickAnim( deltaTime );
-			bar.Widget->ApplyCameraScale( zoomAlpha );
-		}
-
 		if ( !bar.bIsBoss )
 		{
 			bar.HideTimer -= deltaTime;
 			if ( bar.HideTimer <= 0.0f )
 			{
-				expired.Add( pair.Key.Get() );
+				expired.Add( i );
+				continue;
+			}
+
+			if ( bCanLod )
+			{
+				UpdateBarLod( bar, entity, *viewState );
 			}
 		}
+
+		if ( bar.bCulled || !bar.Widget )
+		{
+			continue;
+		}
+
+		if ( bar.bHealthDirty )
+		{
+			if ( const IEntity* entityInterface = Cast<IEntity>( entity ) )
+			{
+				bar.Widget->SetHealth( entityInterface->Stats().Health(), entityInterface->Stats().MaxHealth() );
+			}
+			bar.bHealthDirty = false;
+		}
+
+		bar.Widget->TickAnim( deltaTime );
+		if ( zoomGeneration == 0 || bar.AppliedZoomGeneration != zoomGeneration )
+		{
+			bar.Widget->ApplyCameraScale( zoomAlpha );
+			bar.AppliedZoomGeneration = zoomGeneration;
+		}
+	}
+
+	// Descending order keeps the remaining indices valid across swap-removes.
+	for ( int32 i = expired.Num() - 1; i >= 0; --i )
+	{
+		RemoveBarAt( expired[i] );
+	}
+}
+
+void UHealthBarPoolSubsystem::UpdateBarLod(
+    FActiveHealthBar& bar, AActor* entity, const FCameraViewState& viewState
+)
+{
+	const float offsetZ = bar.Config ? bar.Config->WorldOffsetZ_ : 0.0f;
+	const float minScreenSize = bar.Config ? bar.Config->MinOnScreenSize_ : 0.0f;
+
+	const FVector center = entity->GetActorLocation();
+	const float radius = FMath::Max( entity->GetSimpleCollisionRadius(), 1.0f );
+
+	// Frustum test against a sphere that also covers the bar above the entity.
+	const FVector sphereCenter = center + FVector( 0.0f, 0.0f, offsetZ * 0.5f );
+	const float sphereRadius = radius + FMath::Abs( offsetZ ) * 0.5f;
+	const bool bCullOffscreen = !bar.Config || bar.Config->bCullOffscreen_;
+	bool bWanted = !bCullOffscreen || viewState.Frustum.IntersectSphere( sphereCenter, sphereRadius );
+
+	if ( bWanted && minScreenSize > 0.0f )
+	{
+		const FMatrix& viewProjection = viewState.ViewProjectionMatrix;
+		const FVector4 clipCenter = viewProjection.TransformFVector4( FVector4( center, 1.0 ) );
+		if ( clipCenter.W > 0.0 )
+		{
+			const FVector4 clipEdge = viewProjection.TransformFVector4( FVector4( center + FVector( radius, 0.0, 0.0 ), 1.0 ) );
+			const FVector4 clipEdgeY = viewProjection.TransformFVector4( FVector4( center + FVector( 0.0, radius, 0.0 ), 1.0 ) );
+
+			const double halfWidth = viewState.ViewRect.Width() * 0.5;
+			const double halfHeight = viewState.ViewRect.Height() * 0.5;
+			const FVector2D ndcCenter( clipCenter.X / clipCenter.W, clipCenter.Y / clipCenter.W );
+
+			auto pixelDistance = [&]( const FVector4& clip )
+			{
+				if ( clip.W <= 0.0 )
+				{
+					return 0.0;
+				}
+				const double dx = ( clip.X / clip.W - ndcCenter.X ) * halfWidth;
+				const double dy = ( clip.Y / clip.W - ndcCenter.Y ) * halfHeight;
+				return FMath::Sqrt( dx * dx + dy * dy );
+			};
+
+			const double diameterPixels = 2.0 * FMath::Max( pixelDistance( clipEdge ), pixelDistance( clipEdgeY ) );
+			bWanted = diameterPixels >= minScreenSize;
+		}
+	}
+
+	if ( bWanted == !bar.bCulled )
+	{
+		return;
+	}
+
+	if ( bWanted )
+	{
+		RestoreBar( bar, entity );
+	}
+	else
+	{
+		CullBar( bar );
+	}
+}
+
+void UHealthBarPoolSubsystem::CullBar( FActiveHealthBar& bar )
+{
+	if ( IsValid( bar.WidgetComponent ) )
+	{
+		bar.WidgetComponent->SetWidget( nullptr );
+		bar.WidgetComponent->SetVisibility( false );
+	}
+
+	if ( bar.Widget )
+	{
+		ReleaseWidget( bar.Widget );
+		bar.Widget = nullptr;
 	}
 
-	for ( AActor* entity : expired )
+	bar.bCulled = true;
+}
+
+void UHealthBarPoolSubsystem::RestoreBar( FActiveHealthBar& bar, AActor* entity )
+{
+	const IEntity* entityInterface = Cast<IEntity>( entity );
+	if ( !entityInterface || !IsValid( bar.WidgetComponent ) )
 	{
-		HideFor( entity );
+		return;
 	}
+
+	// No eviction here: it would remove bars while Tick iterates them. Stay culled until a widget frees up.
+	UHealthBarWidget* widget = AcquireWidget( ResolveWidgetClass( entity, bar.Config ), false );
+	if ( !widget )
+	{
+		return;
+	}
+
+	const FEntityStats& stats = entityInterface->Stats();
+	widget->ResetTo( static_cast<float>( stats.Health() ) / FMath::Max( 1, stats.MaxHealth() ) );
+	widget->SetVisibility( ESlateVisibility::SelfHitTestInvisible );
+
+	bar.WidgetComponent->SetWidget( widget );
+	bar.WidgetComponent->SetVisibility( true );
+
+	bar.Widget = widget;
+	bar.bCulled = false;
+	bar.bHealthDirty = false;
+	bar.AppliedZoomGeneration = 0;
 }
@@ -5,18 +5,44 @@
 #include "Core/Saving/GameSaveData.h"
 #include "Core/Saving/GameSaver.h"
 
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Engine/AssetManager.h"
+#include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
 
-void ULevelSubsystem::LoadMainMenu() const
+namespace
 {
+	// Dependencies are only followed inside the project's own content
+	constexpr TCHAR cGameContentRoot[] = TEXT( "/Game/" );
+
+	// Keeps a stray reference (a shared data asset pointing at everything) from pulling the whole project in
+	constexpr int32 cMaxManifestDepth = 6;
+	constexpr int32 cMaxManifestAssets = 4096;
+}
+
+void ULevelSubsystem::Deinitialize()
+{
+	PendingOpenIndex_ = INDEX_NONE;
+	ReleasePreload();
+
+	Super::Deinitialize();
+}
+
+void ULevelSubsystem::LoadMainMenu()
+{
+	PendingOpenIndex_ = INDEX_NONE;
+	ReleasePreload();
+
 	if ( Levels_ )
 	{
 		LoadLevel( Levels_->MainMenuLevel, "main menu" );
 	}
 }
 
-void ULevelSubsystem::LoadLevelChoosingLevel() const
+void ULevelSubsystem::LoadLevelChoosingLevel()
 {
+	PendingOpenIndex_ = INDEX_NONE;
+
 	if ( Levels_ )
 	{
 		LoadLevel( Levels_->LevelChoosingLevel, "level choosing level" );
@@ -27,8 +53,8 @@ void ULevelSubsystem::LoadGameplayLevel( int index )
 {
 	if ( Levels_ && index >= 0 && index < Levels_->GameplayLevels.Num() )
 	{
-		LoadLevel( Levels_->GameplayLevels[index].Level, FString::Printf( TEXT( "gameplay level %d" ), index ) );
 		CurrentLevelIndex_ = index;
+		PreloadAndOpenGameplayLevel( index );
 	}
 }
 
@@ -37,10 +63,176 @@ void ULevelSubsystem::LoadNextLevel()
 	if ( Levels_ && CurrentLevelIndex_ >= -1 && CurrentLevelIndex_ + 1 < Levels_->GameplayLevels.Num() )
 	{
 		++CurrentLevelIndex_;
-		LoadLevel(
-		    Levels_->GameplayLevels[CurrentLevelIndex_].Level, FString::Printf( TEXT( "level %d" ), CurrentLevelIndex_ )
+		PreloadAndOpenGameplayLevel( CurrentLevelIndex_ );
+	}
+}
+
+void ULevelSubsystem::PreloadGameplayLevel( int index )
+{
+	if ( !Levels_ || index < 0 || index >= Levels_->GameplayLevels.Num() )
+	{
+		return;
+	}
+
+	if ( PreloadHandle_.IsValid() && PreloadLevelIndex_ == index )
+	{
+		// Already streaming or resident
+		return;
+	}
+
+	ReleasePreload();
+	PreloadLevelIndex_ = index;
+
+	const TArray<FSoftObjectPath>& manifest = GetPreloadManifest( index );
+	if ( manifest.Num() > 0 )
+	{
+		PreloadHandle_ = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		    manifest, FStreamableDelegate::CreateUObject( this, &ULevelSubsystem::HandlePreloadCompleted, index ),
+		    FStreamableManager::AsyncLoadHighPriority
 		);
 	}
+
+	if ( PreloadHandle_.IsValid() )
+	{
+		PreloadHandle_->BindUpdateDelegate(
+		    FStreamableUpdateDelegate::CreateUObject( this, &ULevelSubsystem::HandlePreloadUpdate )
+		);
+	}
+	else
+	{
+		// Nothing to stream
+		HandlePreloadCompleted( index );
+	}
+}
+
+bool ULevelSubsystem::IsPreloading() const
+{
+	return PreloadHandle_.IsValid() && PreloadHandle_->IsLoadingInProgress();
+}
+
+void ULevelSubsystem::PreloadAndOpenGameplayLevel( int index )
+{
+	PendingOpenIndex_ = index;
+
+	if ( PreloadHandle_.IsValid() && PreloadLevelIndex_ == index && PreloadHandle_->HasLoadCompleted() )
+	{
+		HandlePreloadCompleted( index );
+		return;
+	}
+
+	// Opens the level from HandlePreloadCompleted
+	PreloadGameplayLevel( index );
+}
+
+const TArray<FSoftObjectPath>& ULevelSubsystem::GetPreloadManifest( int index )
+{
+	if ( const TArray<FSoftObjectPath>* cached = PreloadManifests_.Find( index ) )
+	{
+		return *cached;
+	}
+
+	TArray<FSoftObjectPath>& manifest = PreloadManifests_.Add( index );
+
+	const IAssetRegistry* registry = IAssetRegistry::Get();
+	if ( !registry )
+	{
+		return manifest;
+	}
+
+	// Walks every package the level reaches (wave presets, unit and projectile classes, the game mode with its
+	// card pool and VFX config, building data) without stepping into other maps.
+	const FName levelPackage( *Levels_->GameplayLevels[index].Level.ToSoftObjectPath().GetLongPackageName() );
+	const FTopLevelAssetPath worldClassPath = UWorld::StaticClass()->GetClassPathName();
+
+	TSet<FName> visited;
+	visited.Add( levelPackage );
+	// Breadth-first, (package, depth from the level): a package is first reached, and marked visited, on its
+	// shortest path, so the depth cap never hides one that is also reachable within it.
+	TArray<TPair<FName, int32>> frontier = { { levelPackage, 0 } };
+	TArray<FName> dependencies;
+	TArray<FAssetData> assets;
+
+	for ( int32 next = 0; next < frontier.Num() && manifest.Num() < cMaxManifestAssets; ++next )
+	{
+		const auto [package, depth] = frontier[next];
+
+		dependencies.Reset();
+		registry->GetDependencies( package, dependencies );
+		for ( const FName dependency : dependencies )
+		{
+			if ( manifest.Num() >= cMaxManifestAssets )
+			{
+				break;
+			}
+
+			bool bAlreadyVisited = false;
+			visited.Add( dependency, &bAlreadyVisited );
+			if ( bAlreadyVisited || !dependency.ToString().StartsWith( cGameContentRoot ) )
+			{
+				continue;
+			}
+
+			assets.Reset();
+			registry->GetAssetsByPackageName( dependency, assets );
+			if ( assets.ContainsByPredicate(
+			         [&worldClassPath]( const FAssetData& asset ) { return asset.AssetClassPath == worldClassPath; }
+			     ) )
+			{
+				continue;
+			}
+
+			for ( const FAssetData& asset : assets )
+			{
+				manifest.Add( asset.ToSoftObjectPath() );
+			}
+			if ( depth + 1 < cMaxManifestDepth )
+			{
+				frontier.Emplace( dependency, depth + 1 );
+			}
+		}
+	}
+
+	if ( manifest.Num() >= cMaxManifestAssets )
+	{
+		UE_LOG(
+		    LogTemp, Warning, TEXT( "ULevelSubsystem: preload manifest of gameplay level %d hit the %d asset cap" ),
+		    index, cMaxManifestAssets
+		);
+	}
+
+	UE_LOG(
+	    LogTemp, Log, TEXT( "ULevelSubsystem: preload manifest of gameplay level %d has %d assets" ), index,
+	    manifest.Num()
+	);
+	return manifest;
+}
+
+void ULevelSubsystem::HandlePreloadUpdate( TSharedRef<FStreamableHandle> handle ) const
+{
+	OnPreloadProgress.Broadcast( handle->GetProgress() );
+}
+
+void ULevelSubsystem::HandlePreloadCompleted( int index )
+{
+	OnPreloadProgress.Broadcast( 1.0f );
+
+	if ( PendingOpenIndex_ != index || !Levels_ || !Levels_->GameplayLevels.IsValidIndex( index ) )
+	{
+		return;
+	}
+
+	PendingOpenIndex_ = INDEX_NONE;
+	LoadLevel( Levels_->GameplayLevels[index].Level, FString::Printf( TEXT( "gameplay level %d" ), index ) );
+}
+
+void ULevelSubsystem::ReleasePreload()
+{
+	if ( PreloadHandle_.IsValid() )
+	{
+		PreloadHandle_->CancelHandle();
+		PreloadHandle_.Reset();
+	}
+	PreloadLevelIndex_ = INDEX_NONE;
 }
 
 void ULevelSubsystem::SetLevels( TSoftObjectPtr<ULevelsDataAsset> levels )
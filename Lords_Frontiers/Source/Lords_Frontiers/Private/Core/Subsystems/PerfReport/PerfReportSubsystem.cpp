@@ -0,0 +1,155 @@
+#include "Core/Subsystems/PerfReport/PerfReportSubsystem.h"
+
+#include "Core/Subsystems/ProjectilePoolSubsystem/ProjectilePoolSubsystem.h"
+#include "Core/Subsystems/UnitSignificanceSubsystem/UnitSignificanceSubsystem.h"
+
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+
+DEFINE_LOG_CATEGORY_STATIC( LogPerfReport, Log, All );
+
+namespace
+{
+	// Roughly a minute of combat at 60 fps
+	constexpr int32 cExpectedFramesPerWave = 4096;
+}
+
+bool UPerfReportSubsystem::ShouldCreateSubsystem( UObject* outer ) const
+{
+	const UWorld* world = Cast<UWorld>( outer );
+	return world && world->IsGameWorld() && Super::ShouldCreateSubsystem( outer );
+}
+
+void UPerfReportSubsystem::OnWorldBeginPlay( UWorld& inWorld )
+{
+	Super::OnWorldBeginPlay( inWorld );
+
+	if ( UGameInstance* gameInstance = inWorld.GetGameInstance() )
+	{
+		GameLoopManager_ = gameInstance->GetSubsystem<UGameLoopManager>();
+	}
+	if ( GameLoopManager_ )
+	{
+		GameLoopManager_->OnPhaseChanged.AddUniqueDynamic( this, &UPerfReportSubsystem::HandlePhaseChanged );
+	}
+}
+
+void UPerfReportSubsystem::Deinitialize()
+{
+	if ( bSampling_ )
+	{
+		ReportWave();
+	}
+	if ( GameLoopManager_ )
+	{
+		GameLoopManager_->OnPhaseChanged.RemoveDynamic( this, &UPerfReportSubsystem::HandlePhaseChanged );
+		GameLoopManager_ = nullptr;
+	}
+
+	Super::Deinitialize();
+}
+
+TStatId UPerfReportSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT( UPerfReportSubsystem, STATGROUP_Tickables );
+}
+
+void UPerfReportSubsystem::Tick( float deltaTime )
+{
+	// Always consume, so time spent outside combat never leaks into the next wave's first frame
+	uint64 cycles[FGameplayPerf::cSystemCount];
+	FGameplayPerf::ConsumeFrame( cycles );
+	const int32 pathComputations = FGameplayPerf::ConsumePathComputations();
+
+	const UWorld* world = GetWorld();
+	const UUnitSignificanceSubsystem* significance = world->GetSubsystem<UUnitSignificanceSubsystem>();
+	const UProjectilePoolSubsystem* projectilePool = world->GetSubsystem<UProjectilePoolSubsystem>();
+	const int32 units = significance ? significance->GetUnitCount() : 0;
+	const int32 projectiles = projectilePool ? projectilePool->GetTotalActiveCount() : 0;
+
+	SET_DWORD_STAT( STAT_LF_ActiveUnits, units );
+	SET_DWORD_STAT( STAT_LF_ActiveProjectiles, projectiles );
+
+	if ( !bSampling_ )
+	{
+		return;
+	}
+
+	++Frames_;
+	for ( int32 system = 0; system < FGameplayPerf::cSystemCount; ++system )
+	{
+		FrameMs_[system].Add( static_cast<float>( FPlatformTime::ToMilliseconds64( cycles[system] ) ) );
+	}
+	Units_.Add( units );
+	Projectiles_.Add( projectiles );
+	StatusEffects_.Add( FGameplayPerf::GetActiveStatusEffects() );
+	PathComputations_ += pathComputations;
+}
+
+void UPerfReportSubsystem::HandlePhaseChanged( EGameLoopPhase oldPhase, EGameLoopPhase newPhase )
+{
+	if ( newPhase == EGameLoopPhase::Combat )
+	{
+		BeginWave( GameLoopManager_ ? GameLoopManager_->GetCurrentWave() : 0 );
+	}
+	else if ( bSampling_ )
+	{
+		ReportWave();
+	}
+}
+
+void UPerfReportSubsystem::BeginWave( const int32 wave )
+{
+	bSampling_ = true;
+	Wave_ = wave;
+	Frames_ = 0;
+	for ( TArray<float>& samples : FrameMs_ )
+	{
+		samples.Reset( cExpectedFramesPerWave );
+	}
+	Units_ = FPerfCounterSamples();
+	Projectiles_ = FPerfCounterSamples();
+	StatusEffects_ = FPerfCounterSamples();
+	PathComputations_ = 0;
+}
+
+void UPerfReportSubsystem::ReportWave()
+{
+	bSampling_ = false;
+	if ( Frames_ == 0 )
+	{
+		return;
+	}
+
+	UE_LOG(
+	    LogPerfReport, Log, TEXT( "Wave %d: %d combat frames, ms per frame (min / avg / p99 / max)" ), Wave_, Frames_
+	);
+
+	for ( int32 system = 0; system < FGameplayPerf::cSystemCount; ++system )
+	{
+		TArray<float>& samples = FrameMs_[system];
+		samples.Sort();
+
+		double sum = 0.0;
+		for ( const float sample : samples )
+		{
+			sum += sample;
+		}
+
+		const int32 p99Index = FMath::Clamp( FMath::CeilToInt( samples.Num() * 0.99 ) - 1, 0, samples.Num() - 1 );
+		UE_LOG(
+		    LogPerfReport, Log, TEXT( "  %-14s %8.3f %8.3f %8.3f %8.3f" ),
+		    FGameplayPerf::GetSystemName( static_cast<EGameplayPerfSystem>( system ) ), samples[0],
+		    sum / samples.Num(), samples[p99Index], samples.Last()
+		);
+	}
+
+	const double frames = Frames_;
+	UE_LOG(
+	    LogPerfReport, Log,
+	    TEXT( "  Units peak %d avg %.1f | Projectiles peak %d avg %.1f | Status effects peak %d avg %.1f | "
+	          "Paths computed %d" ),
+	    Units_.Peak, Units_.Sum / frames, Projectiles_.Peak, Projectiles_.Sum / frames, StatusEffects_.Peak,
+	    StatusEffects_.Sum / frames, PathComputations_
+	);
+}
@@ -4,6 +4,8 @@
 
 #include "Projectiles/BaseProjectile.h"
 
+#include "EngineUtils.h"
+
 void UProjectilePoolSubsystem::Initialize( FSubsystemCollectionBase& collection )
 {
 	Super::Initialize( collection );
@@ -74,6 +76,33 @@ void UProjectilePoolSubsystem::FinalizeReturn( ABaseProjectile* projectile )
 	Pools.FindOrAdd( projectileClass ).Projectiles.Add( projectile );
 }
 
+void UProjectilePoolSubsystem::ReturnAllActive()
+{
+	UWorld* world = GetWorld();
+	if ( !world )
+	{
+		return;
+	}
+
+	for ( TActorIterator<ABaseProjectile> it( world ); it; ++it )
+	{
+		ABaseProjectile* projectile = *it;
+		if ( projectile->IsInFlight() )
+		{
+			int32& count = ActiveCounts.FindOrAdd( projectile->GetClass() );
+			count = FMath::Max( 0, count - 1 );
+		}
+		else if ( !projectile->IsPendingReturn() )
+		{
+			// Already sitting in a pool.
+			continue;
+		}
+
+		// Skips the trail fade: the battlefield is being cleared.
+		projectile->DeactivateToPool();
+	}
+}
+
 void UProjectilePoolSubsystem::PreWarmPool( TSubclassOf<ABaseProjectile> projectileClass, int32 count )
 {
 	if ( !projectileClass || count <= 0 )
@@ -106,6 +135,16 @@ int32 UProjectilePoolSubsystem::GetActiveCount( TSubclassOf<ABaseProjectile> pro
 	return count ? *count : 0;
 }
 
+int32 UProjectilePoolSubsystem::GetTotalActiveCount() const
+{
+	int32 total = 0;
+	for ( const TPair<TSubclassOf<ABaseProjectile>, int32>& pair : ActiveCounts )
+	{
+		total += pair.Value;
+	}
+	return total;
+}
+
 int32 UProjectilePoolSubsystem::GetPooledCount( TSubclassOf<ABaseProjectile> projectileClass ) const
 {
 	const FProjectilePool* pool = Pools.Find( projectileClass );
@@ -0,0 +1,688 @@
+#include "Core/Subsystems/Replay/ReplaySubsystem.h"
+
+#include "Building/Building.h"
+#include "Building/Construction/BuildManager.h"
+#include "Cards/CardDataAsset.h"
+#include "Cards/CardSubsystem.h"
+#include "Cards/CardTypes.h"
+#include "Core/CoreManager.h"
+#include "Core/Subsystems/FixedStepSimulation/FixedStepSimulationSubsystem.h"
+#include "Core/Subsystems/SessionRandom/SessionRandomSubsystem.h"
+#include "Resources/GameResource.h"
+#include "Resources/ResourceManager.h"
+#include "Units/Unit.h"
+
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/WorldSettings.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Crc.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "UObject/SoftObjectPath.h"
+#include "UObject/UObjectGlobals.h"
+
+DEFINE_LOG_CATEGORY_STATIC( LogReplay, Log, All );
+
+namespace
+{
+	// Minimum argument count per EReplayCommandType; ApplyCards takes any number
+	constexpr int32 cMinArgs[] = { 3, 4, 2, 0, 0, 1, 0, 1 };
+	static_assert( UE_ARRAY_COUNT( cMinArgs ) == static_cast<int32>( EReplayCommandType::Count ) );
+
+	FString GetWorldMapName( const UWorld* world )
+	{
+		FString mapName = world->GetMapName();
+		mapName.RemoveFromStart( world->StreamingLevelsPrefix );
+		return mapName;
+	}
+
+	uint32 HashActorState( const AActor* actor, const int32 health )
+	{
+		const FVector location = actor->GetActorLocation();
+		uint32 hash = FCrc::StrCrc32( *actor->GetClass()->GetName() );
+		hash = HashCombineFast( hash, GetTypeHash( FMath::RoundToInt( location.X ) ) );
+		hash = HashCombineFast( hash, GetTypeHash( FMath::RoundToInt( location.Y ) ) );
+		return HashCombineFast( hash, GetTypeHash( health ) );
+	}
+}
+
+UReplaySubsystem* UReplaySubsystem::Get( const UObject* worldContextObject )
+{
+	const UWorld* world = worldContextObject ? worldContextObject->GetWorld() : nullptr;
+	const UGameInstance* gameInstance = world ? world->GetGameInstance() : nullptr;
+	return gameInstance ? gameInstance->GetSubsystem<UReplaySubsystem>() : nullptr;
+}
+
+void UReplaySubsystem::Initialize( FSubsystemCollectionBase& collection )
+{
+	Super::Initialize( collection );
+
+	GameLoopManager_ = collection.InitializeDependency<UGameLoopManager>();
+	SessionController_ = collection.InitializeDependency<UGameSessionController>();
+
+	if ( GameLoopManager_ )
+	{
+		GameLoopManager_->OnPhaseChanged.AddDynamic( this, &UReplaySubsystem::HandlePhaseChanged );
+	}
+	if ( SessionController_ )
+	{
+		SessionController_->OnGameEndDelegate.AddDynamic( this, &UReplaySubsystem::HandleGameEnded );
+	}
+
+	PostLoadMapHandle_ =
+	    FCoreUObjectDelegates::PostLoadMapWithWorld.AddUObject( this, &UReplaySubsystem::HandlePostLoadMap );
+	WorldTickStartHandle_ =
+	    FWorldDelegates::OnWorldTickStart.AddUObject( this, &UReplaySubsystem::HandleWorldTickStart );
+	WorldPostActorTickHandle_ =
+	    FWorldDelegates::OnWorldPostActorTick.AddUObject( this, &UReplaySubsystem::HandleWorldPostActorTick );
+
+	bRecordingEnabled_ = !FParse::Param( FCommandLine::Get(), TEXT( "NoReplayRecord" ) );
+
+	FString playbackPath;
+	if ( FParse::Value( FCommandLine::Get(), TEXT( "ReplayPlayback=" ), playbackPath ) )
+	{
+		bExitWhenDone_ = true;
+		StartPlayback( playbackPath );
+	}
+}
+
+void UReplaySubsystem::Deinitialize()
+{
+	if ( bSessionActive_ && !bPlayingBack_ && Replay_.Commands.Num() > 0 )
+	{
+		SaveRecording( TEXT( "Abandoned" ) );
+	}
+
+	FCoreUObjectDelegates::PostLoadMapWithWorld.Remove( PostLoadMapHandle_ );
+	FWorldDelegates::OnWorldTickStart.Remove( WorldTickStartHandle_ );
+	FWorldDelegates::OnWorldPostActorTick.Remove( WorldPostActorTickHandle_ );
+	if ( GameLoopManager_ )
+	{
+		GameLoopManager_->OnPhaseChanged.RemoveDynamic( this, &UReplaySubsystem::HandlePhaseChanged );
+	}
+	if ( SessionController_ )
+	{
+		SessionController_->OnGameEndDelegate.RemoveDynamic( this, &UReplaySubsystem::HandleGameEnded );
+	}
+
+	if ( bPlayingBack_ )
+	{
+		USessionRandomSubsystem::SetSessionSeedOverride( 0 );
+		RestoreFrameTimeClamp();
+	}
+
+	Super::Deinitialize();
+}
+
+bool UReplaySubsystem::StartPlayback( const FString& path )
+{
+	FReplayFile replay;
+	if ( !replay.LoadFromFile( path ) )
+	{
+		UE_LOG( LogReplay, Error, TEXT( "Replay: cannot read '%s'" ), *path );
+		return false;
+	}
+
+	if ( bSessionActive_ && !bPlayingBack_ && Replay_.Commands.Num() > 0 )
+	{
+		SaveRecording( TEXT( "Abandoned" ) );
+	}
+	Replay_ = MoveTemp( replay );
+
+	UE_LOG(
+	    LogReplay, Log, TEXT( "Replay: playing '%s' on %s, seed %d, %d commands" ), *path, *Replay_.MapName,
+	    Replay_.SessionSeed, Replay_.Commands.Num()
+	);
+
+	bPlayingBack_ = true;
+	bSessionActive_ = false;
+	Cursor_ = 0;
+	USessionRandomSubsystem::SetSessionSeedOverride( Replay_.SessionSeed );
+
+	// A fresh load of the recorded map starts the session with the recorded seed.
+	UWorld* world = GetGameInstance()->GetWorld();
+	if ( !world )
+	{
+		bAwaitingMap_ = true;
+		return true;
+	}
+
+	UGameplayStatics::OpenLevel( world, FName( *Replay_.MapName ) );
+	return true;
+}
+
+void UReplaySubsystem::HandlePostLoadMap( UWorld* loadedWorld )
+{
+	if ( !bAwaitingMap_ || !loadedWorld )
+	{
+		return;
+	}
+
+	bAwaitingMap_ = false;
+	if ( GetWorldMapName( loadedWorld ) != Replay_.MapName )
+	{
+		UGameplayStatics::OpenLevel( loadedWorld, FName( *Replay_.MapName ) );
+	}
+}
+
+void UReplaySubsystem::HandlePhaseChanged( EGameLoopPhase oldPhase, EGameLoopPhase newPhase )
+{
+	if ( newPhase == EGameLoopPhase::Building &&
+	     ( oldPhase == EGameLoopPhase::Startup || oldPhase == EGameLoopPhase::None ) )
+	{
+		BeginSession();
+	}
+
+	const UWorld* world = GetGameInstance()->GetWorld();
+	if ( !bSessionActive_ || !world )
+	{
+		return;
+	}
+
+	if ( newPhase == EGameLoopPhase::Combat )
+	{
+		CombatStartGameTime_ = world->GetTimeSeconds();
+		CombatStartWallTime_ = FPlatformTime::Seconds();
+		CombatStartFrame_ = SessionFrame_;
+	}
+	else if ( oldPhase == EGameLoopPhase::Combat )
+	{
+		const int32 waveIndex = WaveTimings_.Num();
+		FReplayWaveTiming& timing = WaveTimings_.AddDefaulted_GetRef();
+		timing.Wave = GameLoopManager_->GetCurrentWave();
+		timing.GameSeconds = world->GetTimeSeconds() - CombatStartGameTime_;
+		timing.WallSeconds = FPlatformTime::Seconds() - CombatStartWallTime_;
+		timing.Frames = SessionFrame_ - CombatStartFrame_;
+		timing.StateHash = ComputeStateHash();
+
+		if ( !bPlayingBack_ )
+		{
+			Replay_.WaveHashes.Add( timing.StateHash );
+			return;
+		}
+
+		UE_LOG(
+		    LogReplay, Log, TEXT( "Replay: wave %d  game %.1f s  wall %.2f s  %d frames  hash %08x" ), timing.Wave,
+		    timing.GameSeconds, timing.WallSeconds, timing.Frames, timing.StateHash
+		);
+
+		if ( !Replay_.WaveHashes.IsValidIndex( waveIndex ) )
+		{
+			return;
+		}
+		if ( Replay_.WaveHashes[waveIndex] == timing.StateHash )
+		{
+			++VerifiedWaves_;
+		}
+		else
+		{
+			++DivergedWaves_;
+			UE_LOG(
+			    LogReplay, Error, TEXT( "Replay: wave %d diverged, recorded hash %08x, played %08x" ), timing.Wave,
+			    Replay_.WaveHashes[waveIndex], timing.StateHash
+			);
+		}
+	}
+}
+
+void UReplaySubsystem::HandleGameEnded( const EGameResult result )
+{
+	if ( !bSessionActive_ )
+	{
+		return;
+	}
+
+	bSessionActive_ = false;
+	if ( bPlayingBack_ )
+	{
+		FinishPlayback( result );
+		return;
+	}
+
+	SaveRecording( *StaticEnum<EGameResult>()->GetNameStringByValue( static_cast<int64>( result ) ) );
+	Replay_.Reset();
+}
+
+void UReplaySubsystem::BeginSession()
+{
+	// A restart reloads the level without ending the match; keep what was recorded so far.
+	if ( bSessionActive_ && !bPlayingBack_ && Replay_.Commands.Num() > 0 )
+	{
+		SaveRecording( TEXT( "Abandoned" ) );
+	}
+
+	bSessionActive_ = bPlayingBack_ || bRecordingEnabled_;
+	bInSessionTick_ = false;
+	SessionFrame_ = 0;
+	SessionStartWallTime_ = FPlatformTime::Seconds();
+	WaveTimings_.Reset();
+
+	if ( bPlayingBack_ )
+	{
+		Cursor_ = 0;
+		SkippedCommands_ = 0;
+		VerifiedWaves_ = 0;
+		DivergedWaves_ = 0;
+
+		// Saved before the fast-forward clamps it too, so the original values come back at the end
+		const UWorld* world = GetGameInstance()->GetWorld();
+		if ( const AWorldSettings* worldSettings = world ? world->GetWorldSettings() : nullptr )
+		{
+			if ( !bFrameTimeClampSaved_ )
+			{
+				PrevMinUndilatedFrameTime_ = worldSettings->MinUndilatedFrameTime;
+				PrevMaxUndilatedFrameTime_ = worldSettings->MaxUndilatedFrameTime;
+				bFrameTimeClampSaved_ = true;
+			}
+		}
+
+		if ( SessionController_ )
+		{
+			// Pinned at the fast-forward speed by SetTimerScale while playing back
+			SessionController_->SetTimerScale( UFixedStepSimulationSubsystem::cMaxSpeed );
+		}
+		return;
+	}
+
+	Replay_.Reset();
+	if ( const UWorld* world = GetGameInstance()->GetWorld() )
+	{
+		Replay_.MapName = GetWorldMapName( world );
+		if ( const USessionRandomSubsystem* random = world->GetSubsystem<USessionRandomSubsystem>() )
+		{
+			Replay_.SessionSeed = random->GetSessionSeed();
+		}
+	}
+}
+
+bool UReplaySubsystem::IsSessionWorld( const UWorld* world ) const
+{
+	return bSessionActive_ && world && world == GetGameInstance()->GetWorld();
+}
+
+void UReplaySubsystem::HandleWorldTickStart( UWorld* world, ELevelTick /*tickType*/, float /*deltaSeconds*/ )
+{
+	// Only ticks that started inside the session are counted, in both directions
+	bInSessionTick_ = IsSessionWorld( world ) && !world->IsPaused();
+	if ( !bInSessionTick_ || !bPlayingBack_ || !GameLoopManager_ )
+	{
+		return;
+	}
+
+	const int32 wave = GameLoopManager_->GetCurrentWave();
+	const uint8 phase = static_cast<uint8>( GameLoopManager_->GetCurrentPhase() );
+	while ( Cursor_ < Replay_.Commands.Num() && Replay_.Commands[Cursor_].Tick <= SessionFrame_ )
+	{
+		const FReplayCommand& command = Replay_.Commands[Cursor_];
+		if ( command.Wave != wave || command.Phase != phase )
+		{
+			UE_LOG(
+			    LogReplay, Warning, TEXT( "Replay: command %d recorded in wave %d phase %d runs in wave %d phase %d" ),
+			    Cursor_, command.Wave, command.Phase, wave, phase
+			);
+		}
+		++Cursor_;
+		ExecuteCommand( command );
+	}
+
+	// The fast-forward ticks the world as often as it likes; each tick still advances by the recorded delta.
+	if ( Replay_.FrameDeltas.IsValidIndex( SessionFrame_ ) )
+	{
+		AWorldSettings* worldSettings = world->GetWorldSettings();
+		worldSettings->MinUndilatedFrameTime = Replay_.FrameDeltas[SessionFrame_];
+		worldSettings->MaxUndilatedFrameTime = Replay_.FrameDeltas[SessionFrame_];
+	}
+}
+
+void UReplaySubsystem::HandleWorldPostActorTick( UWorld* world, ELevelTick /*tickType*/, const float deltaSeconds )
+{
+	if ( !bInSessionTick_ || !IsSessionWorld( world ) )
+	{
+		return;
+	}
+
+	bInSessionTick_ = false;
+	if ( !bPlayingBack_ )
+	{
+		Replay_.FrameDeltas.Add( deltaSeconds );
+	}
+	++SessionFrame_;
+}
+
+void UReplaySubsystem::RestoreFrameTimeClamp()
+{
+	if ( !bFrameTimeClampSaved_ )
+	{
+		return;
+	}
+
+	bFrameTimeClampSaved_ = false;
+	const UWorld* world = GetGameInstance()->GetWorld();
+	if ( AWorldSettings* worldSettings = world ? world->GetWorldSettings() : nullptr )
+	{
+		worldSettings->MinUndilatedFrameTime = PrevMinUndilatedFrameTime_;
+		worldSettings->MaxUndilatedFrameTime = PrevMaxUndilatedFrameTime_;
+	}
+}
+
+void UReplaySubsystem::ExecuteCommand( const FReplayCommand& command )
+{
+	const int32 typeIndex = static_cast<int32>( command.Type );
+	if ( command.Args.Num() < cMinArgs[typeIndex] )
+	{
+		UE_LOG( LogReplay, Warning, TEXT( "Replay: command %d is malformed, skipped" ), Cursor_ - 1 );
+		++SkippedCommands_;
+		return;
+	}
+
+	const TArray<int32, TInlineAllocator<4>>& args = command.Args;
+	UCoreManager* core = UCoreManager::Get( this );
+	ABuildManager* buildManager = core ? core->GetBuildManager() : nullptr;
+	UCardSubsystem* cards = UCardSubsystem::Get( this );
+
+	bool bExecuted = true;
+	switch ( command.Type )
+	{
+	case EReplayCommandType::PlaceBuilding:
+	{
+		const TSubclassOf<ABuilding> buildingClass =
+		    FSoftClassPath( Replay_.GetString( args[0] ) ).TryLoadClass<ABuilding>();
+		bExecuted = buildManager && buildingClass &&
+		            buildManager->PlaceBuildingAtCell( buildingClass, FIntPoint( args[1], args[2] ) );
+		break;
+	}
+	case EReplayCommandType::RelocateBuilding:
+		bExecuted =
+		    buildManager &&
+		    buildManager->RelocateBuildingToCell( FIntPoint( args[0], args[1] ), FIntPoint( args[2], args[3] ) );
+		break;
+	case EReplayCommandType::RemoveBuilding:
+		bExecuted = buildManager && buildManager->RemoveBuildingAtCell( FIntPoint( args[0], args[1] ) );
+		break;
+	case EReplayCommandType::EndBuildTurn:
+		GameLoopManager_->EndBuildTurn();
+		break;
+	case EReplayCommandType::StartCombatEarly:
+		GameLoopManager_->StartCombatEarly();
+		break;
+	case EReplayCommandType::RerollCards:
+	{
+		FCardChoice choice;
+		bExecuted = cards && cards->TryRerollCardChoice( command.Wave, args[0], choice );
+		break;
+	}
+	case EReplayCommandType::ApplyCards:
+	{
+		if ( !cards )
+		{
+			bExecuted = false;
+			break;
+		}
+
+		TArray<UCardDataAsset*> selected;
+		for ( const int32 cardIndex : args )
+		{
+			if ( UCardDataAsset* card = cards->FindCardByID( FName( *Replay_.GetString( cardIndex ) ) ) )
+			{
+				selected.Add( card );
+			}
+		}
+		cards->ApplySelectedCards( selected );
+		break;
+	}
+	case EReplayCommandType::SetSpeed:
+		// Speed only changes wall time; playback stays at the fast-forward speed.
+		break;
+	default:
+		bExecuted = false;
+		break;
+	}
+
+	if ( !bExecuted )
+	{
+		UE_LOG( LogReplay, Warning, TEXT( "Replay: command %d (type %d) failed" ), Cursor_ - 1, typeIndex );
+		++SkippedCommands_;
+	}
+}
+
+void UReplaySubsystem::FinishPlayback( const EGameResult result )
+{
+	double gameSeconds = 0.0;
+	double wallSeconds = 0.0;
+	for ( const FReplayWaveTiming& timing : WaveTimings_ )
+	{
+		gameSeconds += timing.GameSeconds;
+		wallSeconds += timing.WallSeconds;
+	}
+
+	UE_LOG(
+	    LogReplay, Log,
+	    TEXT( "Replay: finished (%s) after %d waves, combat %.1f s game / %.2f s wall, total %.2f s wall, "
+	          "%d/%d commands run, %d skipped, %d/%d frames, final hash %08x" ),
+	    *StaticEnum<EGameResult>()->GetNameStringByValue( static_cast<int64>( result ) ), WaveTimings_.Num(),
+	    gameSeconds, wallSeconds, FPlatformTime::Seconds() - SessionStartWallTime_, Cursor_ - SkippedCommands_,
+	    Replay_.Commands.Num(), SkippedCommands_, SessionFrame_, Replay_.FrameDeltas.Num(), ComputeStateHash()
+	);
+	if ( DivergedWaves_ > 0 )
+	{
+		UE_LOG(
+		    LogReplay, Error, TEXT( "Replay: %d/%d recorded wave hashes matched, %d diverged" ), VerifiedWaves_,
+		    Replay_.WaveHashes.Num(), DivergedWaves_
+		);
+	}
+	else
+	{
+		UE_LOG(
+		    LogReplay, Log, TEXT( "Replay: %d/%d recorded wave hashes matched" ), VerifiedWaves_,
+		    Replay_.WaveHashes.Num()
+		);
+	}
+
+	bPlayingBack_ = false;
+	USessionRandomSubsystem::SetSessionSeedOverride( 0 );
+	if ( SessionController_ )
+	{
+		SessionController_->SetTimerScale( 1.0f );
+	}
+	RestoreFrameTimeClamp();
+
+	if ( bExitWhenDone_ )
+	{
+		FPlatformMisc::RequestExit( false, TEXT( "UReplaySubsystem::FinishPlayback" ) );
+	}
+}
+
+FReplayCommand& UReplaySubsystem::AddCommand( const EReplayCommandType type )
+{
+	FReplayCommand& command = Replay_.Commands.AddDefaulted_GetRef();
+	command.Type = type;
+	command.Wave = GameLoopManager_ ? GameLoopManager_->GetCurrentWave() : 0;
+	command.Phase = GameLoopManager_ ? static_cast<uint8>( GameLoopManager_->GetCurrentPhase() ) : 0;
+	command.Tick = SessionFrame_;
+	return command;
+}
+
+void UReplaySubsystem::SaveRecording( const TCHAR* outcome )
+{
+	const FString mapName =
+	    FPaths::MakeValidFileName( Replay_.MapName.IsEmpty() ? FString( TEXT( "UnknownMap" ) ) : Replay_.MapName );
+	const FString timestamp = FDateTime::Now().ToString( TEXT( "%Y-%m-%d_%H-%M-%S" ) );
+	const FString directory = FPaths::ProjectSavedDir() / TEXT( "Replays" );
+	const FString path = directory / FString::Printf( TEXT( "%s_%s_%s.lfreplay" ), *mapName, outcome, *timestamp );
+
+	if ( !Replay_.SaveToFile( path ) )
+	{
+		UE_LOG( LogReplay, Error, TEXT( "Replay: failed to save '%s'" ), *path );
+		return;
+	}
+
+	UE_LOG(
+	    LogReplay, Log, TEXT( "Replay: saved '%s' (%d commands, %d frames, %lld bytes)" ), *path,
+	    Replay_.Commands.Num(), Replay_.FrameDeltas.Num(), IFileManager::Get().FileSize( *path )
+	);
+
+	PruneSavedReplays( directory );
+}
+
+void UReplaySubsystem::PruneSavedReplays( const FString& directory ) const
+{
+	IFileManager& fileManager = IFileManager::Get();
+
+	TArray<FString> files;
+	fileManager.FindFiles( files, *( directory / TEXT( "*.lfreplay" ) ), true, false );
+	if ( files.Num() <= cMaxSavedReplays )
+	{
+		return;
+	}
+
+	using FFileAge = TPair<FDateTime, FString>;
+	TArray<FFileAge> byAge;
+	byAge.Reserve( files.Num() );
+	for ( const FString& file : files )
+	{
+		const FString path = directory / file;
+		byAge.Emplace( fileManager.GetTimeStamp( *path ), path );
+	}
+	byAge.Sort( []( const FFileAge& a, const FFileAge& b ) { return a.Key > b.Key; } );
+
+	for ( int32 i = cMaxSavedReplays; i < byAge.Num(); ++i )
+	{
+		fileManager.Delete( *byAge[i].Value );
+	}
+	UE_LOG( LogReplay, Log, TEXT( "Replay: removed %d old replays" ), byAge.Num() - cMaxSavedReplays );
+}
+
+uint32 UReplaySubsystem::ComputeStateHash() const
+{
+	const UWorld* world = GetGameInstance()->GetWorld();
+	if ( !world )
+	{
+		return 0;
+	}
+
+	// Sums keep the actor part independent of iteration order.
+	uint32 buildingsHash = 0;
+	for ( TActorIterator<ABuilding> it( world ); it; ++it )
+	{
+		const ABuilding* building = *it;
+		if ( IsValid( building ) && !building->IsActorBeingDestroyed() )
+		{
+			buildingsHash += HashActorState( building, building->Stats().Health() );
+		}
+	}
+
+	uint32 unitsHash = 0;
+	for ( TActorIterator<AUnit> it( world ); it; ++it )
+	{
+		const AUnit* unit = *it;
+		if ( IsValid( unit ) && !unit->IsActorBeingDestroyed() )
+		{
+			unitsHash += HashActorState( unit, unit->Stats().Health() );
+		}
+	}
+
+	uint32 hash = HashCombineFast( buildingsHash, unitsHash );
+	hash = HashCombineFast( hash, GetTypeHash( GameLoopManager_ ? GameLoopManager_->GetCurrentWave() : 0 ) );
+
+	const UCoreManager* core = UCoreManager::Get( this );
+	if ( const UResourceManager* resources = core ? core->GetResourceManager() : nullptr )
+	{
+		for ( uint8 type = static_cast<uint8>( EResourceType::Gold ); type < static_cast<uint8>( EResourceType::Max );
+		      ++type )
+		{
+			const int32 amount = resources->GetResourceAmount( static_cast<EResourceType>( type ) );
+			hash = HashCombineFast( hash, GetTypeHash( amount ) );
+		}
+	}
+
+	if ( const UCardSubsystem* cards = UCardSubsystem::Get( this ) )
+	{
+		for ( const FAppliedCardRecord& record : cards->GetAppliedCardHistory() )
+		{
+			const uint32 cardHash = record.Card ? FCrc::StrCrc32( *record.Card->CardID.ToString() ) : 0;
+			hash = HashCombineFast( hash, HashCombineFast( cardHash, GetTypeHash( record.StackCount ) ) );
+		}
+	}
+
+	return hash;
+}
+
+void UReplaySubsystem::RecordPlaceBuilding( const TSubclassOf<ABuilding> buildingClass, const FIntPoint& cell )
+{
+	if ( !bSessionActive_ || bPlayingBack_ || !buildingClass )
+	{
+		return;
+	}
+	const int32 classIndex = Replay_.InternString( buildingClass->GetPathName() );
+	AddCommand( EReplayCommandType::PlaceBuilding ).Args = { classIndex, cell.X, cell.Y };
+}
+
+void UReplaySubsystem::RecordRelocateBuilding( const FIntPoint& fromCell, const FIntPoint& toCell )
+{
+	if ( bSessionActive_ && !bPlayingBack_ )
+	{
+		AddCommand( EReplayCommandType::RelocateBuilding ).Args = { fromCell.X, fromCell.Y, toCell.X, toCell.Y };
+	}
+}
+
+void UReplaySubsystem::RecordRemoveBuilding( const FIntPoint& cell )
+{
+	if ( bSessionActive_ && !bPlayingBack_ )
+	{
+		AddCommand( EReplayCommandType::RemoveBuilding ).Args = { cell.X, cell.Y };
+	}
+}
+
+void UReplaySubsystem::RecordEndBuildTurn()
+{
+	if ( bSessionActive_ && !bPlayingBack_ )
+	{
+		AddCommand( EReplayCommandType::EndBuildTurn );
+	}
+}
+
+void UReplaySubsystem::RecordStartCombatEarly()
+{
+	if ( bSessionActive_ && !bPlayingBack_ )
+	{
+		AddCommand( EReplayCommandType::StartCombatEarly );
+	}
+}
+
+void UReplaySubsystem::RecordRerollCards( const int32 rerollIndex )
+{
+	if ( bSessionActive_ && !bPlayingBack_ )
+	{
+		AddCommand( EReplayCommandType::RerollCards ).Args = { FMath::Max( rerollIndex, 0 ) };
+	}
+}
+
+void UReplaySubsystem::RecordApplyCards( const TArray<UCardDataAsset*>& cards )
+{
+	if ( !bSessionActive_ || bPlayingBack_ )
+	{
+		return;
+	}
+
+	FReplayCommand& command = AddCommand( EReplayCommandType::ApplyCards );
+	for ( const UCardDataAsset* card : cards )
+	{
+		if ( card )
+		{
+			command.Args.Add( Replay_.InternString( card->CardID.ToString() ) );
+		}
+	}
+}
+
+void UReplaySubsystem::RecordSetSpeed( const float speed )
+{
+	if ( bSessionActive_ && !bPlayingBack_ )
+	{
+		AddCommand( EReplayCommandType::SetSpeed ).Args = { FMath::Max( 0, FMath::RoundToInt( speed * 100.0f ) ) };
+	}
+}
@@ -0,0 +1,211 @@
+#include "Core/Subsystems/Replay/ReplayTypes.h"
+
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+#include <bit>
+
+namespace
+{
+	// Upper bounds on what a file may claim, so a corrupt one fails instead of allocating
+	// About four days of world ticks at 60 fps
+	constexpr int32 cMaxFrameDeltas = 1 << 25;
+	constexpr int32 cMaxCommands = 1 << 20;
+	constexpr int32 cMaxCommandArgs = 256;
+
+	void SerializePacked( FArchive& ar, int32& value )
+	{
+		uint32 packed = static_cast<uint32>( FMath::Max( value, 0 ) );
+		ar.SerializeIntPacked( packed );
+		value = static_cast<int32>( packed );
+	}
+
+	// Loading only: a count must fit its cap and can never exceed the bytes left to read
+	bool IsValidCount( const FArchive& ar, const int32 count, const int32 maxCount )
+	{
+		return count >= 0 && count <= maxCount && count <= ar.TotalSize() - ar.Tell();
+	}
+
+	/**
+	 * Lossless, since playback has to feed the simulation the exact floats it ran with. Each run of equal deltas is
+	 * one token: the zigzag difference of its bit pattern from the previous run's, shifted up by one, with the low
+	 * bit flagging a run length that follows. Nearby frame times differ in the low mantissa bits only, so a jittery
+	 * variable-rate frame takes about three bytes; fixed-step and capped-rate stretches take a few bytes per run.
+	 */
+	void SerializeFrameDeltas( FArchive& ar, TArray<float>& deltas )
+	{
+		int32 count = deltas.Num();
+		SerializePacked( ar, count );
+		if ( ar.IsLoading() )
+		{
+			// Runs make the count independent of the bytes left, so only the cap applies; not reserved up front
+			if ( count < 0 || count > cMaxFrameDeltas )
+			{
+				ar.SetError();
+				return;
+			}
+			deltas.Reset();
+		}
+
+		uint32 previousBits = 0;
+		for ( int32 index = 0; index < count && !ar.IsError(); )
+		{
+			int32 runLength = 1;
+			uint64 token = 0;
+			if ( ar.IsSaving() )
+			{
+				const uint32 bits = std::bit_cast<uint32>( deltas[index] );
+				while ( index + runLength < count && std::bit_cast<uint32>( deltas[index + runLength] ) == bits )
+				{
+					++runLength;
+				}
+				const int64 diff = static_cast<int64>( bits ) - static_cast<int64>( previousBits );
+				const uint64 zigzag = ( static_cast<uint64>( diff ) << 1 ) ^ static_cast<uint64>( diff >> 63 );
+				token = ( zigzag << 1 ) | ( runLength > 1 ? 1 : 0 );
+			}
+
+			ar.SerializeIntPacked64( token );
+			if ( token & 1 )
+			{
+				SerializePacked( ar, runLength );
+			}
+
+			if ( ar.IsLoading() )
+			{
+				if ( ar.IsError() || runLength < 1 || runLength > count - index )
+				{
+					ar.SetError();
+					return;
+				}
+				const uint64 zigzag = token >> 1;
+				const int64 diff = static_cast<int64>( zigzag >> 1 ) ^ -static_cast<int64>( zigzag & 1 );
+				const float value = std::bit_cast<float>( static_cast<uint32>( previousBits + diff ) );
+				for ( int32 i = 0; i < runLength; ++i )
+				{
+					deltas.Add( value );
+				}
+			}
+
+			previousBits = std::bit_cast<uint32>( deltas[index] );
+			index += runLength;
+		}
+	}
+}
+
+int32 FReplayFile::InternString( const FString& value )
+{
+	const int32 existing = Strings.IndexOfByKey( value );
+	return existing != INDEX_NONE ? existing : Strings.Add( value );
+}
+
+const FString& FReplayFile::GetString( const int32 index ) const
+{
+	static const FString empty;
+	return Strings.IsValidIndex( index ) ? Strings[index] : empty;
+}
+
+void FReplayFile::Reset()
+{
+	SessionSeed = 0;
+	MapName.Reset();
+	Strings.Reset();
+	Commands.Reset();
+	FrameDeltas.Reset();
+	WaveHashes.Reset();
+}
+
+bool FReplayFile::Serialize( FArchive& ar )
+{
+	uint32 magic = cMagic;
+	uint16 version = cVersion;
+	ar << magic;
+	ar << version;
+	if ( ar.IsLoading() && ( magic != cMagic || version != cVersion ) )
+	{
+		UE_LOG( LogTemp, Error, TEXT( "Replay: unsupported file (magic %08x, version %d)" ), magic, version );
+		return false;
+	}
+
+	ar << SessionSeed;
+	ar << MapName;
+	ar << Strings;
+
+	int32 commandCount = Commands.Num();
+	SerializePacked( ar, commandCount );
+	if ( ar.IsLoading() )
+	{
+		if ( !IsValidCount( ar, commandCount, cMaxCommands ) )
+		{
+			ar.SetError();
+			return false;
+		}
+		Commands.SetNum( commandCount );
+	}
+
+	// Ticks are stored as deltas from the previous command, so commands issued together take one byte.
+	int32 previousTick = 0;
+	for ( FReplayCommand& command : Commands )
+	{
+		uint8 type = static_cast<uint8>( command.Type );
+		ar << type;
+		ar << command.Phase;
+		SerializePacked( ar, command.Wave );
+
+		int32 tickDelta = command.Tick - previousTick;
+		SerializePacked( ar, tickDelta );
+		command.Tick = previousTick + tickDelta;
+		previousTick = command.Tick;
+
+		int32 argCount = command.Args.Num();
+		SerializePacked( ar, argCount );
+		if ( ar.IsLoading() )
+		{
+			if ( !IsValidCount( ar, argCount, cMaxCommandArgs ) )
+			{
+				ar.SetError();
+				return false;
+			}
+			command.Type = static_cast<EReplayCommandType>( type );
+			command.Args.SetNum( argCount );
+		}
+		for ( int32& arg : command.Args )
+		{
+			SerializePacked( ar, arg );
+		}
+
+		if ( ar.IsError() || type >= static_cast<uint8>( EReplayCommandType::Count ) )
+		{
+			return false;
+		}
+	}
+
+	SerializeFrameDeltas( ar, FrameDeltas );
+	ar << WaveHashes;
+
+	return !ar.IsError();
+}
+
+bool FReplayFile::SaveToFile( const FString& path )
+{
+	TArray<uint8> bytes;
+	FMemoryWriter writer( bytes );
+	if ( !Serialize( writer ) )
+	{
+		return false;
+	}
+	return FFileHelper::SaveArrayToFile( bytes, *path );
+}
+
+bool FReplayFile::LoadFromFile( const FString& path )
+{
+	TArray<uint8> bytes;
+	if ( !FFileHelper::LoadFileToArray( bytes, *path ) )
+	{
+		return false;
+	}
+
+	Reset();
+	FMemoryReader reader( bytes );
+	return Serialize( reader );
+}
@@ -0,0 +1,219 @@
+#include "Core/Subsystems/ScreenAnchorSubsystem/ScreenAnchorSubsystem.h"
+
+#include "Core/Subsystems/CameraViewSubsystem/CameraViewSubsystem.h"
+
+#include "Blueprint/WidgetLayoutLibrary.h"
+#include "Components/CanvasPanelSlot.h"
+#include "Components/Widget.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Kismet/GameplayStatics.h"
+
+namespace
+{
+	// Slot writes below this distance (in slate units) are skipped to avoid needless invalidation.
+	constexpr float cMinMoveDistance = 1.0f;
+
+	// Anchors this far (in pixels) outside the view rect still count as on screen: widgets extend past their anchor.
+	constexpr double cCullMargin = 64.0;
+}
+
+TStatId UScreenAnchorSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT( UScreenAnchorSubsystem, STATGROUP_Tickables );
+}
+
+void UScreenAnchorSubsystem::Tick( float deltaTime )
+{
+	FlushAnchors();
+}
+
+void UScreenAnchorSubsystem::RegisterAnchor(
+    UWidget* widget, const FVector& worldLocation, const ESlateVisibility visibleState
+)
+{
+	if ( !widget )
+	{
+		return;
+	}
+
+	if ( const int32* existing = IndexByWidget_.Find( widget ) )
+	{
+		WorldLocations_[*existing] = worldLocation;
+		VisibleStates_[*existing] = visibleState;
+		NeverApplied_[*existing] = true;
+		bAnchorsDirty_ = true;
+		return;
+	}
+
+	const int32 index = Widgets_.Add( widget );
+	WorldLocations_.Add( worldLocation );
+	VisibleStates_.Add( visibleState );
+	AppliedPositions_.Add( FVector2D::ZeroVector );
+	AppliedOnScreen_.Add( false );
+	NeverApplied_.Add( true );
+	IndexByWidget_.Add( widget, index );
+	bAnchorsDirty_ = true;
+}
+
+void UScreenAnchorSubsystem::UnregisterAnchor( UWidget* widget )
+{
+	if ( const int32* index = IndexByWidget_.Find( widget ) )
+	{
+		RemoveAt( *index );
+	}
+}
+
+void UScreenAnchorSubsystem::RemoveAt( const int32 index )
+{
+	IndexByWidget_.Remove( Widgets_[index] );
+
+	const int32 last = Widgets_.Num() - 1;
+	if ( index != last )
+	{
+		WorldLocations_[index] = WorldLocations_[last];
+		Widgets_[index] = Widgets_[last];
+		VisibleStates_[index] = VisibleStates_[last];
+		AppliedPositions_[index] = AppliedPositions_[last];
+		AppliedOnScreen_[index] = AppliedOnScreen_[last];
+		NeverApplied_[index] = NeverApplied_[last];
+		IndexByWidget_.Add( Widgets_[index], index );
+	}
+
+	WorldLocations_.RemoveAt( last, EAllowShrinking::No );
+	Widgets_.RemoveAt( last, EAllowShrinking::No );
+	VisibleStates_.RemoveAt( last, EAllowShrinking::No );
+	AppliedPositions_.RemoveAt( last, EAllowShrinking::No );
+	AppliedOnScreen_.RemoveAt( last );
+	NeverApplied_.RemoveAt( last );
+}
+
+void UScreenAnchorSubsystem::FlushAnchors()
+{
+	for ( int32 i = Widgets_.Num() - 1; i >= 0; --i )
+	{
+		if ( !Widgets_[i].IsValid() )
+		{
+			RemoveAt( i );
+		}
+	}
+
+	if ( Widgets_.IsEmpty() )
+	{
+		return;
+	}
+
+	const float viewportScale = UWidgetLayoutLibrary::GetViewportScale( this );
+	if ( viewportScale <= 0.0f )
+	{
+		return;
+	}
+
+	const FCameraViewState* viewState = UCameraViewSubsystem::FindState( this );
+	const bool bViewChanged =
+	    !viewState || !viewState->bHasView || viewState->ViewGeneration != ProjectedViewGeneration_;
+	if ( !bViewChanged && !bAnchorsDirty_ && viewportScale == ProjectedViewportScale_ )
+	{
+		return;
+	}
+
+	ProjectedViewportScale_ = viewportScale;
+	ProjectedViewGeneration_ = viewState ? viewState->ViewGeneration : 0;
+	bAnchorsDirty_ = false;
+
+	ProjectAll();
+	ApplyResults();
+}
+
+void UScreenAnchorSubsystem::ProjectAll()
+{
+	const int32 count = WorldLocations_.Num();
+	ProjectedPositions_.SetNumUninitialized( count );
+	ProjectedOnScreen_.Init( false, count );
+
+	const FCameraViewState* viewState = UCameraViewSubsystem::FindState( this );
+	if ( !viewState || !viewState->bHasView )
+	{
+		// No cached view yet (camera not ticked): fall back to the player controller per anchor.
+		const APlayerController* pc = UGameplayStatics::GetPlayerController( this, 0 );
+		for ( int32 i = 0; i < count; ++i )
+		{
+			FVector2D screen;
+			if ( pc && pc->ProjectWorldLocationToScreen( WorldLocations_[i], screen ) )
+			{
+				ProjectedPositions_[i] = screen / ProjectedViewportScale_;
+				ProjectedOnScreen_[i] = true;
+			}
+		}
+		return;
+	}
+
+	// Same math as FSceneView::ProjectWorldToScreen, over contiguous arrays and without UObject access.
+	const FMatrix& viewProjection = viewState->ViewProjectionMatrix;
+	const FIntRect& viewRect = viewState->ViewRect;
+	const double rectMinX = viewRect.Min.X;
+	const double rectMinY = viewRect.Min.Y;
+	const double rectWidth = viewRect.Width();
+	const double rectHeight = viewRect.Height();
+	const double invScale = 1.0 / ProjectedViewportScale_;
+
+	for ( int32 i = 0; i < count; ++i )
+	{
+		const FVector4 clip = viewProjection.TransformFVector4( FVector4( WorldLocations_[i], 1.0 ) );
+		if ( clip.W <= 0.0 )
+		{
+			continue;
+		}
+
+		const double rhw = 1.0 / clip.W;
+		const double normalizedX = clip.X * rhw * 0.5 + 0.5;
+		const double normalizedY = 0.5 - clip.Y * rhw * 0.5;
+
+		const double pixelX = rectMinX + normalizedX * rectWidth;
+		const double pixelY = rectMinY + normalizedY * rectHeight;
+
+		ProjectedPositions_[i] = FVector2D( pixelX * invScale, pixelY * invScale );
+		ProjectedOnScreen_[i] = pixelX >= rectMinX - cCullMargin && pixelX <= rectMinX + rectWidth + cCullMargin &&
+		                        pixelY >= rectMinY - cCullMargin && pixelY <= rectMinY + rectHeight + cCullMargin;
+	}
+}
+
+void UScreenAnchorSubsystem::ApplyResults()
+{
+	const float minMoveSq = cMinMoveDistance * cMinMoveDistance;
+
+	for ( int32 i = 0; i < Widgets_.Num(); ++i )
+	{
+		UWidget* widget = Widgets_[i].Get();
+		const bool bOnScreen = ProjectedOnScreen_[i];
+		const bool bFirst = NeverApplied_[i];
+
+		if ( !bOnScreen )
+		{
+			if ( bFirst || AppliedOnScreen_[i] )
+			{
+				widget->SetVisibility( ESlateVisibility::Collapsed );
+				AppliedOnScreen_[i] = false;
+				NeverApplied_[i] = false;
+			}
+			continue;
+		}
+
+		const FVector2D& position = ProjectedPositions_[i];
+		if ( bFirst || FVector2D::DistSquared( position, AppliedPositions_[i] ) >= minMoveSq )
+		{
+			if ( UCanvasPanelSlot* slot = Cast<UCanvasPanelSlot>( widget->Slot ) )
+			{
+				slot->SetPosition( position );
+			}
+			AppliedPositions_[i] = position;
+		}
+
+		if ( bFirst || !AppliedOnScreen_[i] )
+		{
+			widget->SetVisibility( VisibleStates_[i] );
+			AppliedOnScreen_[i] = true;
+		}
+		NeverApplied_[i] = false;
+	}
+}
@@ -0,0 +1,439 @@
+#include "Core/Subsystems/SessionLogger/SessionEventLog.h"
+
+#include "HAL/FileManager.h"
+#include "Misc/Compression.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/Archive.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+DEFINE_LOG_CATEGORY_STATIC( LogSessionEventLog, Log, All );
+
+namespace
+{
+	enum class EChunkTag : uint8
+	{
+		Table = 1,
+		Names = 2,
+		End = 3
+	};
+
+	// Guards the reader against corrupt sizes
+	constexpr int32 cMaxChunkBytes = 64 * 1024 * 1024;
+
+	template <typename TFunc>
+	void VisitTable( FSessionEventLog& log, const ESessionEventTable table, TFunc&& func )
+	{
+		switch ( table )
+		{
+		case ESessionEventTable::Damage:
+			func( log.Damage );
+			break;
+		case ESessionEventTable::Death:
+			func( log.Deaths );
+			break;
+		case ESessionEventTable::Placement:
+			func( log.Placements );
+			break;
+		case ESessionEventTable::Resources:
+			func( log.Resources );
+			break;
+		case ESessionEventTable::Phase:
+			func( log.Phases );
+			break;
+		default:
+			break;
+		}
+	}
+
+	template <typename TColumns>
+	void ResetColumns( TColumns& columns )
+	{
+		columns.ForEachColumn( []( auto& column ) { column.Reset(); } );
+	}
+
+	template <typename TColumns>
+	void AddKey( TColumns& columns, const float time, const int32 wave )
+	{
+		columns.Time.Add( time );
+		columns.Wave.Add( static_cast<uint16>( FMath::Clamp( wave, 0, MAX_uint16 ) ) );
+	}
+
+	void SerializeHeader( FArchive& ar, FString& mapName, FString& timestamp, int32& sessionSeed, bool& bOutValid )
+	{
+		uint32 magic = SessionEventLog::cMagic;
+		uint16 version = SessionEventLog::cVersion;
+		ar << magic;
+		ar << version;
+		bOutValid = magic == SessionEventLog::cMagic && version == SessionEventLog::cVersion;
+		if ( !bOutValid )
+		{
+			return;
+		}
+		ar << mapName;
+		ar << timestamp;
+		ar << sessionSeed;
+	}
+}
+
+// FSessionEventLog
+
+void FSessionEventLog::ResetTables()
+{
+	for ( uint8 table = 0; table < static_cast<uint8>( ESessionEventTable::Count ); ++table )
+	{
+		VisitTable( *this, static_cast<ESessionEventTable>( table ), []( auto& columns ) { ResetColumns( columns ); } );
+	}
+}
+
+bool FSessionEventLog::LoadFromFile( const FString& path, FSessionEventLog& outLog )
+{
+	TArray<uint8> bytes;
+	if ( !FFileHelper::LoadFileToArray( bytes, *path ) )
+	{
+		return false;
+	}
+
+	FMemoryReader reader( bytes );
+	bool bValid = false;
+	SerializeHeader( reader, outLog.MapName, outLog.Timestamp, outLog.SessionSeed, bValid );
+	if ( !bValid || reader.IsError() )
+	{
+		UE_LOG( LogSessionEventLog, Warning, TEXT( "Not a session event log: %s" ), *path );
+		return false;
+	}
+
+	TArray<uint8> compressed;
+	TArray<uint8> raw;
+	while ( !reader.AtEnd() && !reader.IsError() )
+	{
+		uint8 tag = 0;
+		reader << tag;
+
+		if ( tag == static_cast<uint8>( EChunkTag::Names ) )
+		{
+			int32 count = 0;
+			reader << count;
+			for ( int32 i = 0; i < count && !reader.IsError(); ++i )
+			{
+				FString name;
+				reader << name;
+				outLog.Names.Add( FName( *name ) );
+			}
+		}
+		else if ( tag == static_cast<uint8>( EChunkTag::Table ) )
+		{
+			uint8 table = 0;
+			int32 rows = 0;
+			int32 rawSize = 0;
+			int32 compressedSize = 0;
+			reader << table << rows << rawSize << compressedSize;
+
+			if ( reader.IsError() || rawSize < 0 || rawSize > cMaxChunkBytes || compressedSize < 0 ||
+			     compressedSize > reader.TotalSize() - reader.Tell() )
+			{
+				break;
+			}
+
+			compressed.SetNumUninitialized( compressedSize );
+			reader.Serialize( compressed.GetData(), compressedSize );
+			raw.SetNumUninitialized( rawSize );
+			if ( !FCompression::UncompressMemory(
+			         NAME_Zlib, raw.GetData(), rawSize, compressed.GetData(), compressedSize
+			     ) )
+			{
+				UE_LOG( LogSessionEventLog, Warning, TEXT( "Corrupt chunk in %s, stopping there" ), *path );
+				break;
+			}
+
+			// Columns come in the order ForEachColumn visits them; each is appended to the loaded table.
+			FMemoryReader chunkReader( raw );
+			VisitTable(
+			    outLog, static_cast<ESessionEventTable>( table ),
+			    [&chunkReader]( auto& columns )
+			    {
+				    columns.ForEachColumn(
+				        [&chunkReader]( auto& column )
+				        {
+					        typename TRemoveReference<decltype( column )>::Type chunkColumn;
+					        chunkReader << chunkColumn;
+					        column.Append( MoveTemp( chunkColumn ) );
+				        }
+				    );
+			    }
+			);
+		}
+		else if ( tag == static_cast<uint8>( EChunkTag::End ) )
+		{
+			reader << outLog.Outcome;
+			reader << outLog.WavesSurvived;
+			break;
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	return true;
+}
+
+// FSessionEventLogWriter
+
+FSessionEventLogWriter::FSessionEventLogWriter() = default;
+
+FSessionEventLogWriter::~FSessionEventLogWriter()
+{
+	if ( IsOpen() )
+	{
+		Close( TEXT( "Incomplete" ), 0 );
+	}
+}
+
+bool FSessionEventLogWriter::Open(
+    const FString& path, const FString& mapName, const FString& timestamp, const int32 sessionSeed
+)
+{
+	if ( IsOpen() )
+	{
+		Close( TEXT( "Incomplete" ), 0 );
+	}
+
+	File_.Reset( IFileManager::Get().CreateFileWriter( *path ) );
+	if ( !File_ )
+	{
+		UE_LOG( LogSessionEventLog, Error, TEXT( "Cannot open %s for writing" ), *path );
+		return false;
+	}
+
+	Pending_ = FSessionEventLog();
+	NameIndex_.Reset();
+	NamesWritten_ = 0;
+	InternName( NAME_None );
+
+	FString headerMap = mapName;
+	FString headerTimestamp = timestamp;
+	int32 headerSeed = sessionSeed;
+	bool bValid = true;
+	SerializeHeader( *File_, headerMap, headerTimestamp, headerSeed, bValid );
+	return true;
+}
+
+void FSessionEventLogWriter::Close( const FString& outcome, int32 wavesSurvived )
+{
+	if ( !IsOpen() )
+	{
+		return;
+	}
+
+	for ( uint8 table = 0; table < static_cast<uint8>( ESessionEventTable::Count ); ++table )
+	{
+		FlushTable( static_cast<ESessionEventTable>( table ) );
+	}
+	WriteNewNames();
+
+	// The end chunk goes after every chunk still in flight
+	WritePipe_.WaitUntilEmpty();
+
+	uint8 tag = static_cast<uint8>( EChunkTag::End );
+	FString endOutcome = outcome;
+	*File_ << tag;
+	*File_ << endOutcome;
+	*File_ << wavesSurvived;
+
+	File_->Close();
+	File_.Reset();
+}
+
+uint16 FSessionEventLogWriter::InternName( const FName name )
+{
+	if ( const uint16* existing = NameIndex_.Find( name ) )
+	{
+		return *existing;
+	}
+	if ( Pending_.Names.Num() > MAX_uint16 )
+	{
+		return 0;
+	}
+
+	const uint16 index = static_cast<uint16>( Pending_.Names.Add( name ) );
+	NameIndex_.Add( name, index );
+	return index;
+}
+
+void FSessionEventLogWriter::AddDamage(
+    const float time, const int32 wave, const FName source, const FName target, const int32 amount, const uint8 flags
+)
+{
+	if ( !IsOpen() )
+	{
+		return;
+	}
+
+	FSessionDamageColumns& columns = Pending_.Damage;
+	AddKey( columns, time, wave );
+	columns.Source.Add( InternName( source ) );
+	columns.Target.Add( InternName( target ) );
+	columns.Amount.Add( amount );
+	columns.Flags.Add( flags );
+	OnRowAdded( ESessionEventTable::Damage, columns.Time.Num() );
+}
+
+void FSessionEventLogWriter::AddDeath(
+    const float time, const int32 wave, const FName victim, const FName killer, const uint8 flags
+)
+{
+	if ( !IsOpen() )
+	{
+		return;
+	}
+
+	FSessionDeathColumns& columns = Pending_.Deaths;
+	AddKey( columns, time, wave );
+	columns.Victim.Add( InternName( victim ) );
+	columns.Killer.Add( InternName( killer ) );
+	columns.Flags.Add( flags );
+	OnRowAdded( ESessionEventTable::Death, columns.Time.Num() );
+}
+
+void FSessionEventLogWriter::AddPlacement(
+    const float time, const int32 wave, const FName building, const FIntPoint& cell
+)
+{
+	if ( !IsOpen() )
+	{
+		return;
+	}
+
+	FSessionPlacementColumns& columns = Pending_.Placements;
+	AddKey( columns, time, wave );
+	columns.Building.Add( InternName( building ) );
+	columns.CellX.Add( static_cast<int16>( cell.X ) );
+	columns.CellY.Add( static_cast<int16>( cell.Y ) );
+	OnRowAdded( ESessionEventTable::Placement, columns.Time.Num() );
+}
+
+void FSessionEventLogWriter::AddResources(
+    const float time, const int32 wave, const int32 turn, const int32 gold, const int32 food, const int32 population,
+    const int32 progress
+)
+{
+	if ( !IsOpen() )
+	{
+		return;
+	}
+
+	FSessionResourceColumns& columns = Pending_.Resources;
+	AddKey( columns, time, wave );
+	columns.Turn.Add( static_cast<uint8>( FMath::Clamp( turn, 0, MAX_uint8 ) ) );
+	columns.Gold.Add( gold );
+	columns.Food.Add( food );
+	columns.Population.Add( population );
+	columns.Progress.Add( progress );
+	OnRowAdded( ESessionEventTable::Resources, columns.Time.Num() );
+}
+
+void FSessionEventLogWriter::AddPhase( const float time, const int32 wave, const uint8 oldPhase, const uint8 newPhase )
+{
+	if ( !IsOpen() )
+	{
+		return;
+	}
+
+	FSessionPhaseColumns& columns = Pending_.Phases;
+	AddKey( columns, time, wave );
+	columns.OldPhase.Add( oldPhase );
+	columns.NewPhase.Add( newPhase );
+	OnRowAdded( ESessionEventTable::Phase, columns.Time.Num() );
+}
+
+void FSessionEventLogWriter::OnRowAdded( const ESessionEventTable table, const int32 rows )
+{
+	if ( rows >= SessionEventLog::cRowsPerChunk )
+	{
+		FlushTable( table );
+	}
+}
+
+void FSessionEventLogWriter::FlushTable( const ESessionEventTable table )
+{
+	TArray<uint8> raw;
+	int32 rows = 0;
+	VisitTable(
+	    Pending_, table,
+	    [&raw, &rows]( auto& columns )
+	    {
+		    rows = columns.Time.Num();
+		    if ( rows > 0 )
+		    {
+			    FMemoryWriter writer( raw );
+			    columns.ForEachColumn( [&writer]( auto& column ) { writer << column; } );
+			    ResetColumns( columns );
+		    }
+	    }
+	);
+
+	if ( rows == 0 )
+	{
+		return;
+	}
+
+	// Names used by these rows must precede them in the file.
+	WriteNewNames();
+
+	const uint8 tableId = static_cast<uint8>( table );
+	WritePipe_.Launch(
+	    TEXT( "SessionEventLogChunk" ),
+	    [this, tableId, rows, raw = MoveTemp( raw )]() { WriteTableChunk( tableId, rows, raw ); }
+	);
+}
+
+void FSessionEventLogWriter::WriteTableChunk( uint8 tableId, int32 rows, const TArray<uint8>& raw )
+{
+	int32 rawSize = raw.Num();
+	int32 compressedSize = FCompression::CompressMemoryBound( NAME_Zlib, rawSize );
+	TArray<uint8> compressed;
+	compressed.SetNumUninitialized( compressedSize );
+	if ( !FCompression::CompressMemory( NAME_Zlib, compressed.GetData(), compressedSize, raw.GetData(), rawSize ) )
+	{
+		UE_LOG( LogSessionEventLog, Error, TEXT( "Compression failed, %d rows dropped" ), rows );
+		return;
+	}
+
+	uint8 tag = static_cast<uint8>( EChunkTag::Table );
+	*File_ << tag << tableId << rows << rawSize << compressedSize;
+	File_->Serialize( compressed.GetData(), compressedSize );
+
+	// A crash loses at most the chunk being written
+	File_->Flush();
+}
+
+void FSessionEventLogWriter::WriteNewNames()
+{
+	int32 count = Pending_.Names.Num() - NamesWritten_;
+	if ( count <= 0 )
+	{
+		return;
+	}
+
+	TArray<FString> names;
+	names.Reserve( count );
+	for ( int32 i = NamesWritten_; i < Pending_.Names.Num(); ++i )
+	{
+		names.Add( Pending_.Names[i].ToString() );
+	}
+	NamesWritten_ = Pending_.Names.Num();
+
+	WritePipe_.Launch(
+	    TEXT( "SessionEventLogNames" ),
+	    [this, count, names = MoveTemp( names )]() mutable
+	    {
+		    uint8 tag = static_cast<uint8>( EChunkTag::Names );
+		    *File_ << tag << count;
+		    for ( FString& name : names )
+		    {
+			    *File_ << name;
+		    }
+	    }
+	);
+}
@@ -14,7 +14,9 @@
 #include "Core/GameLoop/GameLoopManager.h"
 #include "Core/Subsystems/SessionLogger/DamageEvent.h"
 #include "Core/Subsystems/SessionLogger/ISessionDataCollector.h"
+#include "Core/Subsystems/SessionRandom/SessionRandomSubsystem.h"
 #include "Dom/JsonObject.h"
+#include "Entity.h"
 #include "Grid/GridCell.h"
 #include "Grid/GridManager.h"
 #include "Resources/EconomyComponent.h"
@@ -85,6 +87,12 @@ const FLogTurnData* USessionLoggerSubsystem::GetCurrentTurnData() const
 
 // Lifecycle
 
+bool USessionLoggerSubsystem::ShouldCreateSubsystem( UObject* outer ) const
+{
+	const UWorld* world = Cast<UWorld>( outer );
+	return world && world->IsGameWorld() && Super::ShouldCreateSubsystem( outer );
+}
+
 void USessionLoggerSubsystem::Initialize( FSubsystemCollectionBase& Collection )
 {
 	Super::Initialize( Collection );
@@ -128,6 +136,16 @@ void USessionLoggerSubsystem::OnCoreSystemsReady()
 	BindToSystems();
 }
 
+void USessionLoggerSubsystem::Tick( float deltaTime )
+{
+	DrainDamageEvents();
+}
+
+TStatId USessionLoggerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT( USessionLoggerSubsystem, STATGROUP_Tickables );
+}
+
 void USessionLoggerSubsystem::Deinitialize()
 {
 	// If the world is torn down while a session is active (e.g. level reload),
@@ -135,12 +153,15 @@ void USessionLoggerSubsystem::Deinitialize()
 	// destroyed at this point, so FinalizeWave/EndCurrentTurn would crash.
 	if ( bIsLogging_ )
 	{
+		DrainDamageEvents();
+
 		SessionData_.bVictory = false;
 		SessionData_.WavesSurvived = CurrentWaveNumber_;
 		SessionOutcome_ = TEXT( "RestartExit" );
 		SessionData_.TotalSessionDurationSeconds = static_cast<float>( FPlatformTime::Seconds() - SessionStartTime_ );
 
 		WriteSessionToFile();
+		CloseEventLog();
 		bIsLogging_ = false;
 	}
 
@@ -285,6 +306,8 @@ int32 USessionLoggerSubsystem::GetCurrentWaveNumber() const
 
 void USessionLoggerSubsystem::HandlePhaseChanged( EGameLoopPhase oldPhase, EGameLoopPhase newPhase )
 {
+	DrainDamageEvents();
+
 	for ( ISessionDataCollector* collector : DataCollectors_ )
 	{
 		if ( collector )
@@ -310,8 +333,15 @@ void USessionLoggerSubsystem::HandlePhaseChanged( EGameLoopPhase oldPhase, EGame
 			{
 				SessionData_.MapName = world->GetMapName();
 				SessionData_.MapName.RemoveFromStart( world->StreamingLevelsPrefix );
+
+				if ( const USessionRandomSubsystem* random = world->GetSubsystem<USessionRandomSubsystem>() )
+				{
+					SessionData_.SessionSeed = random->GetSessionSeed();
+				}
 			}
 			SessionData_.Timestamp = FDateTime::Now().ToString( TEXT( "%Y-%m-%dT%H:%M:%S" ) );
+			SessionStartGameTime_ = world ? world->GetTimeSeconds() : 0.0;
+			OpenEventLog();
 
 			SessionData_.InitialFieldState = CaptureBuildMapState( 0 );
 
@@ -363,12 +393,18 @@ void USessionLoggerSubsystem::HandlePhaseChanged( EGameLoopPhase oldPhase, EGame
 	default:
 		break;
 	}
+
+	EventLog_.AddPhase(
+	    GetSessionGameSeconds(), CurrentWaveNumber_, static_cast<uint8>( oldPhase ), static_cast<uint8>( newPhase )
+	);
 }
 
 // Turn Changed Handler
 
 void USessionLoggerSubsystem::HandleBuildTurnChanged( int32 currentTurn, int32 maxTurns )
 {
+	DrainDamageEvents();
+
 	for ( ISessionDataCollector* collector : DataCollectors_ )
 	{
 		if ( collector )
@@ -385,6 +421,7 @@ void USessionLoggerSubsystem::HandleBuildTurnChanged( int32 currentTurn, int32 m
 
 void USessionLoggerSubsystem::HandleWaveChanged( int32 currentWave, int32 totalWaves )
 {
+	DrainDamageEvents();
 	CurrentWaveNumber_ = currentWave;
 
 	for ( ISessionDataCollector* collector : DataCollectors_ )
@@ -429,6 +466,7 @@ void USessionLoggerSubsystem::HandleBuildingPlaced( ABuilding* building, FIntPoi
 	CollectBonusDataForBuilding( building, cellCoords, record.BonusesReceived, record.BonusesGiven );
 
 	turnData->BuildingsPlaced.Add( record );
+	EventLog_.AddPlacement( GetSessionGameSeconds(), CurrentWaveNumber_, record.BuildingClass, cellCoords );
 
 	AccumulatedBuildCost_ += record.Cost;
 	SessionData_.TotalBuildingsPlaced++;
@@ -447,6 +485,9 @@ void USessionLoggerSubsystem::HandleBuildingPlaced( ABuilding* building, FIntPoi
 
 void USessionLoggerSubsystem::HandleBuildingDied( ABuilding* building )
 {
+	// LastAttackerMap_ must include every hit queued before this death
+	DrainDamageEvents();
+
 	FLogTurnData* turnData = GetCurrentTurnData();
 	if ( !turnData || !building )
 	{
@@ -466,6 +507,11 @@ void USessionLoggerSubsystem::HandleBuildingDied( ABuilding* building )
 	SessionData_.TotalBuildingsLost++;
 
 	FName* lastAttacker = LastAttackerMap_.Find( building );
+	EventLog_.AddDeath(
+	    GetSessionGameSeconds(), CurrentWaveNumber_, record.BuildingClass, lastAttacker ? *lastAttacker : NAME_None,
+	    SessionEventLog::cFlagBuilding
+	);
+
 	if ( lastAttacker )
 	{
 		FLogEnemyDamageAccumulator& enemyAcc = EnemyDamageMap_.FindOrAdd( *lastAttacker );
@@ -548,7 +594,7 @@ void USessionLoggerSubsystem::HandleCardsApplied( const TArray<UCardDataAsset*>&
 	}
 }
 
-// Damage Handler (dispatcher)
+// Damage Handler (producer)
 
 void USessionLoggerSubsystem::HandleDamageDealt( AActor* instigator, AActor* target, int damage, bool bIsSplash )
 {
@@ -557,44 +603,100 @@ void USessionLoggerSubsystem::HandleDamageDealt( AActor* instigator, AActor* tar
 		return;
 	}
 
-	if ( ADefensiveBuilding* tower = Cast<ADefensiveBuilding>( instigator ) )
+	FSessionDamageRecord record;
+	record.Instigator = instigator;
+	record.Target = target;
+	record.InstigatorClass = instigator->GetClass();
+	record.TargetClass = target->GetClass();
+	record.Time = GetSessionGameSeconds();
+	record.Amount = damage;
+	record.Wave = static_cast<uint16>( FMath::Clamp( CurrentWaveNumber_, 0, MAX_uint16 ) );
+	record.Flags = bIsSplash ? SessionEventLog::cFlagSplash : 0;
+	record.Flags |= instigator->IsA<ADefensiveBuilding>() ? SessionEventLog::cFlagFromTower : 0;
+	record.Flags |= target->IsA<ABuilding>() ? SessionEventLog::cFlagBuilding : 0;
+
+	// Raised just before the damage is applied, so this is the last moment to tell which hit kills
+	if ( const IEntity* entity = Cast<IEntity>( target ) )
+	{
+		const FEntityStats& stats = entity->Stats();
+		record.Flags |= stats.IsAlive() && damage >= stats.Health() ? SessionEventLog::cFlagKill : 0;
+	}
+
+	// A full ring means a burst bigger than a frame's worth; drain it here rather than lose hits.
+	if ( !DamageRing_.Push( record ) )
+	{
+		DrainDamageEvents();
+		DamageRing_.Push( record );
+	}
+}
+
+// Damage Drain (consumer)
+
+void USessionLoggerSubsystem::DrainDamageEvents()
+{
+	DamageBatch_.Reset();
+	if ( DamageRing_.Drain( DamageBatch_ ) == 0 )
+	{
+		return;
+	}
+
+	for ( const FSessionDamageRecord& record : DamageBatch_ )
 	{
-		AccumulateTowerDamage( tower, target, damage, bIsSplash );
+		EventLog_.AddDamage(
+		    record.Time, record.Wave, record.InstigatorClass->GetFName(), record.TargetClass->GetFName(),
+		    record.Amount, record.Flags
+		);
+
+		if ( record.Flags & SessionEventLog::cFlagFromTower )
+		{
+			AccumulateTowerDamage( record );
+		}
+		else if ( record.InstigatorClass->IsChildOf<AUnit>() )
+		{
+			AccumulateEnemyDamage( record );
+		}
 	}
 
-	if ( AUnit* enemy = Cast<AUnit>( instigator ) )
+	const TArrayView<const FSessionDamageRecord> batch( DamageBatch_ );
+	for ( ISessionDataCollector* collector : DataCollectors_ )
 	{
-		AccumulateEnemyDamage( enemy, target, damage );
+		if ( collector )
+		{
+			collector->OnDamageEvents( batch );
+		}
 	}
 }
 
 // Tower Damage Accumulation
 
-void USessionLoggerSubsystem::AccumulateTowerDamage(
-    ADefensiveBuilding* tower, AActor* target, int damage, bool bIsSplash
-)
+void USessionLoggerSubsystem::AccumulateTowerDamage( const FSessionDamageRecord& record )
 {
-	FName instigatorClass = tower->GetClass()->GetFName();
+	FName instigatorClass = record.InstigatorClass->GetFName();
 	FLogDamageAccumulator& acc = TowerDamageMap_.FindOrAdd( instigatorClass );
 	acc.InstigatorClass = instigatorClass;
 
 	if ( acc.AttackType.IsEmpty() )
 	{
-		acc.AttackType = tower->Stats().AttackRange() >= RangedAttackThreshold_ ? TEXT( "Ranged" ) : TEXT( "Melee" );
+		if ( const ADefensiveBuilding* tower = Cast<ADefensiveBuilding>( record.Instigator.Get( true ) ) )
+		{
+			acc.AttackType =
+			    tower->Stats().AttackRange() >= RangedAttackThreshold_ ? TEXT( "Ranged" ) : TEXT( "Melee" );
+		}
 	}
 
-	if ( bIsSplash )
+	if ( record.Flags & SessionEventLog::cFlagSplash )
 	{
-		acc.SplashDamage += damage;
+		acc.SplashDamage += record.Amount;
 	}
 	else
 	{
-		acc.DirectDamage += damage;
+		acc.DirectDamage += record.Amount;
 		acc.ShotsTotal++;
 		acc.ShotsHit++;
 	}
 
-	AUnit* targetUnit = Cast<AUnit>( target );
+	// Units that died this frame are pending kill but still readable
+	AUnit* targetUnit = Cast<AUnit>( record.Target.Get( true ) );
 	if ( !targetUnit )
 	{
 		return;
@@ -602,15 +704,16 @@ void USessionLoggerSubsystem::AccumulateTowerDamage(
 
 	EnemyLastTowerMap_.Add( targetUnit, instigatorClass );
 
-	if ( !targetUnit->Stats().IsAlive() )
+	if ( record.Flags & SessionEventLog::cFlagKill )
 	{
-		FName enemyClass = targetUnit->GetClass()->GetFName();
+		FName enemyClass = record.TargetClass->GetFName();
 
 		FLogEnemyDamageAccumulator& enemyAcc = EnemyDamageMap_.FindOrAdd( enemyClass );
 		enemyAcc.EnemyClass = enemyClass;
 		enemyAcc.Killed++;
 
 		acc.KillCount++;
+		EventLog_.AddDeath( record.Time, record.Wave, enemyClass, instigatorClass, SessionEventLog::cFlagFromTower );
 
 		if ( GridManager_.IsValid() )
 		{
@@ -638,28 +741,28 @@ void USessionLoggerSubsystem::AccumulateTowerDamage(
 
 // Enemy Damage Accumulation
 
-void USessionLoggerSubsystem::AccumulateEnemyDamage( AUnit* enemy, AActor* target, int damage )
+void USessionLoggerSubsystem::AccumulateEnemyDamage( const FSessionDamageRecord& record )
 {
-	FName instigatorClass = enemy->GetClass()->GetFName();
+	FName instigatorClass = record.InstigatorClass->GetFName();
 	FLogEnemyDamageAccumulator& enemyAcc = EnemyDamageMap_.FindOrAdd( instigatorClass );
 	enemyAcc.EnemyClass = instigatorClass;
-	enemyAcc.TotalDamage += damage;
+	enemyAcc.TotalDamage += record.Amount;
 
-	FString targetClassName = target->GetClass()->GetName();
+	FString targetClassName = record.TargetClass->GetName();
 	if ( targetClassName.Contains( TEXT( "Wall" ) ) )
 	{
-		enemyAcc.DamageToWalls += damage;
+		enemyAcc.DamageToWalls += record.Amount;
 	}
-	else if ( Cast<ADefensiveBuilding>( target ) )
+	else if ( record.TargetClass->IsChildOf<ADefensiveBuilding>() )
 	{
-		enemyAcc.DamageToDefensive += damage;
+		enemyAcc.DamageToDefensive += record.Amount;
 	}
-	else if ( Cast<ABuilding>( target ) )
+	else if ( record.TargetClass->IsChildOf<ABuilding>() )
 	{
-		enemyAcc.DamageToEconomic += damage;
+		enemyAcc.DamageToEconomic += record.Amount;
 	}
 
-	if ( ABuilding* targetBuilding = Cast<ABuilding>( target ) )
+	if ( ABuilding* targetBuilding = Cast<ABuilding>( record.Target.Get( true ) ) )
 	{
 		LastAttackerMap_.Add( targetBuilding, instigatorClass );
 	}
@@ -1254,6 +1357,8 @@ void USessionLoggerSubsystem::BeginNewTurn( int32 turnNumber, const FString& tur
 
 void USessionLoggerSubsystem::EndCurrentTurn()
 {
+	DrainDamageEvents();
+
 	FLogTurnData* turnData = GetCurrentTurnData();
 	if ( !turnData )
 	{
@@ -1269,6 +1374,10 @@ void USessionLoggerSubsystem::EndCurrentTurn()
 
 	// Resources at end
 	turnData->ResourcesAtEnd = CaptureCurrentResources();
+	EventLog_.AddResources(
+	    GetSessionGameSeconds(), CurrentWaveNumber_, turnData->TurnNumber, turnData->ResourcesAtEnd.Gold,
+	    turnData->ResourcesAtEnd.Food, turnData->ResourcesAtEnd.Population, turnData->ResourcesAtEnd.Progress
+	);
 
 	// Economy data (maintenance, cards, adjacency, income)
 	CaptureTurnEconomy();
@@ -1595,12 +1704,21 @@ void USessionLoggerSubsystem::FinalizeSession( bool bVictory )
 	}
 
 	WriteSessionToFile();
+	CloseEventLog();
 
 	OnSessionFinalized.Broadcast( SessionData_ );
 
 	bIsLogging_ = false;
 }
 
+// ClearEnemyTracking
+
+void USessionLoggerSubsystem::ClearEnemyTracking()
+{
+	DrainDamageEvents();
+	EnemyLastTowerMap_.Reset();
+}
+
 // FinalizeSessionOnRestart
 
 void USessionLoggerSubsystem::FinalizeSessionOnRestart()
@@ -1638,16 +1756,52 @@ void USessionLoggerSubsystem::FinalizeSessionOnRestart()
 	}
 
 	WriteSessionToFile();
+	CloseEventLog();
 
 	OnSessionFinalized.Broadcast( SessionData_ );
 
 	bIsLogging_ = false;
 }
 
+// Binary Event Log
+
+void USessionLoggerSubsystem::OpenEventLog()
+{
+	const FString mapName =
+	    FPaths::MakeValidFileName( SessionData_.MapName.IsEmpty() ? TEXT( "UnknownMap" ) : SessionData_.MapName );
+	const FString timestamp = FDateTime::Now().ToString( TEXT( "%Y-%m-%d_%H-%M-%S" ) );
+	const FString filePath = FPaths::ConvertRelativePathToFull(
+	    FPaths::ProjectDir() / TEXT( "SessionLogs" ) / FString::Printf( TEXT( "%s_%s.lfslog" ), *mapName, *timestamp )
+	);
+
+	IFileManager::Get().MakeDirectory( *FPaths::GetPath( filePath ), true );
+	if ( EventLog_.Open( filePath, SessionData_.MapName, SessionData_.Timestamp, SessionData_.SessionSeed ) )
+	{
+		UE_LOG( LogSessionLogger, Log, TEXT( "Session event log: %s" ), *filePath );
+	}
+}
+
+void USessionLoggerSubsystem::CloseEventLog()
+{
+	EventLog_.Close( SessionOutcome_, SessionData_.WavesSurvived );
+}
+
+float USessionLoggerSubsystem::GetSessionGameSeconds() const
+{
+	const UWorld* world = GetWorld();
+	return world ? static_cast<float>( world->GetTimeSeconds() - SessionStartGameTime_ ) : 0.0f;
+}
+
 // JSON Output (GZip compressed)
 
 void USessionLoggerSubsystem::WriteSessionToFile()
 {
+	// The binary event log is the primary output; the JSON report is kept for debugging.
+	if ( !FParse::Param( FCommandLine::Get(), TEXT( "SessionLogJson" ) ) )
+	{
+		return;
+	}
+
 	TSharedPtr<FJsonObject> rootJson = SessionData_.ToJson();
 
 	for ( ISessionDataCollector* collector : DataCollectors_ )
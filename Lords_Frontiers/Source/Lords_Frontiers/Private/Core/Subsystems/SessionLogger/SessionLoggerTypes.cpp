@@ -469,6 +469,7 @@ TSharedPtr<FJsonObject> FLogSessionData::ToJson() const
 	auto SessionObj = MakeShared<FJsonObject>();
 	SessionObj->SetStringField( TEXT( "mapName" ), MapName );
 	SessionObj->SetStringField( TEXT( "timestamp" ), Timestamp );
+	SessionObj->SetNumberField( TEXT( "sessionSeed" ), SessionSeed );
 	SessionObj->SetStringField( TEXT( "outcome" ), bVictory ? TEXT( "Victory" ) : TEXT( "Defeat" ) );
 	SessionObj->SetNumberField( TEXT( "wavesSurvived" ), WavesSurvived );
 	SessionObj->SetObjectField( TEXT( "initialFieldState" ), InitialFieldState.ToJson() );
@@ -0,0 +1,65 @@
+#include "Core/Subsystems/SessionRandom/SessionRandomSubsystem.h"
+
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Crc.h"
+#include "Misc/Parse.h"
+
+int32 USessionRandomSubsystem::SessionSeedOverride_ = 0;
+
+bool USessionRandomSubsystem::ShouldCreateSubsystem( UObject* outer ) const
+{
+	const UWorld* world = Cast<UWorld>( outer );
+	return world && world->IsGameWorld() && Super::ShouldCreateSubsystem( outer );
+}
+
+void USessionRandomSubsystem::Initialize( FSubsystemCollectionBase& collection )
+{
+	Super::Initialize( collection );
+
+	int32 seed = SessionSeedOverride_;
+	if ( seed == 0 )
+	{
+		FParse::Value( FCommandLine::Get(), TEXT( "SessionSeed=" ), seed );
+	}
+	if ( seed == 0 )
+	{
+		seed = static_cast<int32>( FPlatformTime::Cycles64() & MAX_int32 ) | 1;
+	}
+
+	SessionSeed_ = seed;
+	Streams_.Reset();
+
+	UE_LOG( LogTemp, Log, TEXT( "SessionRandom: session seed %d" ), SessionSeed_ );
+}
+
+void USessionRandomSubsystem::SetSessionSeedOverride( const int32 seed )
+{
+	SessionSeedOverride_ = seed;
+}
+
+FRandomStream& USessionRandomSubsystem::GetStream( const FName streamName )
+{
+	if ( FRandomStream* existing = Streams_.Find( streamName ) )
+	{
+		return *existing;
+	}
+
+	// FName hashes differ between runs, the CRC of the text does not.
+	const uint32 nameHash = FCrc::StrCrc32( *streamName.ToString() );
+	const int32 streamSeed = static_cast<int32>( HashCombineFast( static_cast<uint32>( SessionSeed_ ), nameHash ) );
+	return Streams_.Add( streamName, FRandomStream( streamSeed ) );
+}
+
+FRandomStream& USessionRandomSubsystem::Stream( const UObject* worldContextObject, const FName streamName )
+{
+	const UWorld* world = worldContextObject ? worldContextObject->GetWorld() : nullptr;
+	if ( USessionRandomSubsystem* subsystem = world ? world->GetSubsystem<USessionRandomSubsystem>() : nullptr )
+	{
+		return subsystem->GetStream( streamName );
+	}
+
+	static FRandomStream fallback( 0 );
+	return fallback;
+}
@@ -0,0 +1,137 @@
+#include "Core/Subsystems/SpawnScheduler/SpawnSchedulerSubsystem.h"
+
+#include "Components/SpawnAbilityComponent.h"
+#include "Units/Unit.h"
+#include "Units/UnitBuilder.h"
+#include "Utilities/GameplayStats.h"
+
+#include "Components/CapsuleComponent.h"
+#include "Engine/World.h"
+
+namespace
+{
+	// Summoned minions finished per frame; the rest wait in the queue for the next frames
+	constexpr int32 cMaxSpawnsPerFrame = 4;
+
+	// Upper bound of the phase offset given to a newly registered summoner
+	constexpr float cMaxPhaseOffset = 0.5f;
+
+	// Fractional part of the golden ratio: consecutive offsets never bunch up
+	constexpr float cPhaseStep = 0.618034f;
+}
+
+bool USpawnSchedulerSubsystem::ShouldCreateSubsystem( UObject* outer ) const
+{
+	const UWorld* world = Cast<UWorld>( outer );
+	return world && world->IsGameWorld() && Super::ShouldCreateSubsystem( outer );
+}
+
+void USpawnSchedulerSubsystem::Initialize( FSubsystemCollectionBase& collection )
+{
+	Super::Initialize( collection );
+
+	UnitBuilder_ = NewObject<UUnitBuilder>( this );
+}
+
+void USpawnSchedulerSubsystem::Deinitialize()
+{
+	Summoners_.Reset();
+	PendingSpawns_.Reset();
+	ClassInfo_.Reset();
+	UnitBuilder_ = nullptr;
+
+	Super::Deinitialize();
+}
+
+TStatId USpawnSchedulerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT( USpawnSchedulerSubsystem, STATGROUP_Tickables );
+}
+
+float USpawnSchedulerSubsystem::RegisterSummoner( USpawnAbilityComponent* summoner )
+{
+	if ( !summoner )
+	{
+		return 0.f;
+	}
+
+	Summoners_.AddUnique( summoner );
+
+	PhaseSequence_ = FMath::Frac( PhaseSequence_ + cPhaseStep );
+	return PhaseSequence_ * cMaxPhaseOffset;
+}
+
+void USpawnSchedulerSubsystem::UnregisterSummoner( USpawnAbilityComponent* summoner )
+{
+	Summoners_.RemoveSingleSwap( summoner, EAllowShrinking::No );
+}
+
+void USpawnSchedulerSubsystem::EnqueueSpawn( USpawnAbilityComponent* summoner, const bool bRequireTarget )
+{
+	PendingSpawns_.Add( { summoner, bRequireTarget } );
+}
+
+const FSpawnedUnitClassInfo& USpawnSchedulerSubsystem::GetClassInfo( const TSubclassOf<AUnit>& unitClass )
+{
+	if ( const FSpawnedUnitClassInfo* cached = ClassInfo_.Find( unitClass.Get() ) )
+	{
+		return *cached;
+	}
+
+	FSpawnedUnitClassInfo info;
+	if ( unitClass )
+	{
+		if ( const AUnit* defaultUnit = unitClass->GetDefaultObject<AUnit>() )
+		{
+			if ( const UCapsuleComponent* capsule = defaultUnit->FindComponentByClass<UCapsuleComponent>() )
+			{
+				info.CapsuleRadius = capsule->GetUnscaledCapsuleRadius();
+				info.CapsuleHalfHeight = capsule->GetUnscaledCapsuleHalfHeight();
+			}
+		}
+	}
+	return ClassInfo_.Add( unitClass.Get(), info );
+}
+
+void USpawnSchedulerSubsystem::Tick( float deltaTime )
+{
+	const double now = GetWorld()->GetTimeSeconds();
+
+	for ( int32 i = Summoners_.Num() - 1; i >= 0; --i )
+	{
+		USpawnAbilityComponent* summoner = Summoners_[i].Get();
+		if ( !summoner )
+		{
+			Summoners_.RemoveAtSwap( i, 1, EAllowShrinking::No );
+			continue;
+		}
+		summoner->AdvanceSchedule( now, *this );
+	}
+
+	DrainSpawnQueue();
+}
+
+void USpawnSchedulerSubsystem::DrainSpawnQueue()
+{
+	if ( PendingSpawns_.Num() == 0 || !UnitBuilder_ )
+	{
+		return;
+	}
+
+	int32 consumed = 0;
+	int32 spawned = 0;
+	while ( consumed < PendingSpawns_.Num() && spawned < cMaxSpawnsPerFrame )
+	{
+		const FPendingSpawn& pending = PendingSpawns_[consumed++];
+		if ( USpawnAbilityComponent* summoner = pending.Summoner.Get() )
+		{
+			LF_SCOPE_CYCLE_COUNTER( SpawnEnemy );
+			if ( summoner->SpawnQueuedUnit( *UnitBuilder_, pending.bRequireTarget ) )
+			{
+				++spawned;
+			}
+		}
+	}
+
+	PendingSpawns_.RemoveAt( 0, consumed, EAllowShrinking::No );
+}
@@ -0,0 +1,161 @@
+#include "Core/Subsystems/UnitSignificanceSubsystem/UnitSignificanceSubsystem.h"
+
+#include "Core/Subsystems/CameraViewSubsystem/CameraViewSubsystem.h"
+#include "Units/Unit.h"
+
+namespace
+{
+	// Tiers are re-evaluated once per this many frames.
+	constexpr uint32 cUpdateEveryFrames = 4;
+
+	// Projected unit radius (px) at or above which the unit runs at full rate.
+	constexpr double cNearScreenRadius = 24.0;
+
+	// Below this radius, or outside the frustum, the unit drops to the lowest tier.
+	constexpr double cFarScreenRadius = 8.0;
+}
+
+TStatId UUnitSignificanceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT( UUnitSignificanceSubsystem, STATGROUP_Tickables );
+}
+
+void UUnitSignificanceSubsystem::RegisterUnit( AUnit* unit )
+{
+	if ( !unit || IndexByUnit_.Contains( unit ) )
+	{
+		return;
+	}
+
+	IndexByUnit_.Add( unit, Units_.Add( unit ) );
+	Keys_.Add( unit );
+	Tiers_.Add( EUnitLodTier::Near );
+
+	// Evaluate the newcomer on the next frame rather than leaving it at full rate for a whole cycle
+	FramesUntilUpdate_ = 0;
+}
+
+void UUnitSignificanceSubsystem::UnregisterUnit( AUnit* unit )
+{
+	if ( const int32* index = IndexByUnit_.Find( unit ) )
+	{
+		RemoveAt( *index );
+	}
+}
+
+void UUnitSignificanceSubsystem::RemoveAt( const int32 index )
+{
+	IndexByUnit_.Remove( Keys_[index] );
+
+	const int32 last = Units_.Num() - 1;
+	if ( index != last )
+	{
+		Units_[index] = Units_[last];
+		Keys_[index] = Keys_[last];
+		Tiers_[index] = Tiers_[last];
+		IndexByUnit_.Add( Keys_[index], index );
+	}
+	Units_.RemoveAt( last, EAllowShrinking::No );
+	Keys_.RemoveAt( last, EAllowShrinking::No );
+	Tiers_.RemoveAt( last, EAllowShrinking::No );
+}
+
+void UUnitSignificanceSubsystem::RemoveStaleUnits()
+{
+	int32 write = 0;
+	for ( int32 read = 0; read < Units_.Num(); ++read )
+	{
+		if ( !Units_[read].IsValid() )
+		{
+			continue;
+		}
+		if ( write != read )
+		{
+			Units_[write] = Units_[read];
+			Keys_[write] = Keys_[read];
+			Tiers_[write] = Tiers_[read];
+		}
+		++write;
+	}
+
+	if ( write == Units_.Num() )
+	{
+		return;
+	}
+
+	Units_.SetNum( write, EAllowShrinking::No );
+	Keys_.SetNum( write, EAllowShrinking::No );
+	Tiers_.SetNum( write, EAllowShrinking::No );
+
+	IndexByUnit_.Reset();
+	for ( int32 i = 0; i < Keys_.Num(); ++i )
+	{
+		IndexByUnit_.Add( Keys_[i], i );
+	}
+}
+
+void UUnitSignificanceSubsystem::Tick( float deltaTime )
+{
+	if ( FramesUntilUpdate_ > 0 )
+	{
+		--FramesUntilUpdate_;
+		return;
+	}
+	FramesUntilUpdate_ = cUpdateEveryFrames - 1;
+
+	const FCameraViewState* viewState = UCameraViewSubsystem::FindState( this );
+	if ( !viewState || !viewState->bHasView )
+	{
+		return;
+	}
+
+	for ( int32 i = Units_.Num() - 1; i >= 0; --i )
+	{
+		AUnit* unit = Units_[i].Get();
+		if ( !unit )
+		{
+			RemoveAt( i );
+			continue;
+		}
+
+		const EUnitLodTier tier = ComputeTier( *unit, *viewState );
+		if ( tier != Tiers_[i] )
+		{
+			Tiers_[i] = tier;
+			unit->ApplyLodTier( tier );
+		}
+	}
+}
+
+EUnitLodTier UUnitSignificanceSubsystem::ComputeTier( const AUnit& unit, const FCameraViewState& viewState ) const
+{
+	if ( unit.IsBoss() )
+	{
+		return EUnitLodTier::Near;
+	}
+
+	const FVector center = unit.GetActorLocation();
+	const float radius = FMath::Max( unit.GetSimpleCollisionRadius(), 1.0f );
+	if ( !viewState.Frustum.IntersectSphere( center, radius ) )
+	{
+		return EUnitLodTier::Far;
+	}
+
+	const FMatrix& viewProjection = viewState.ViewProjectionMatrix;
+	const FVector4 clipCenter = viewProjection.TransformFVector4( FVector4( center, 1.0 ) );
+	const FVector4 clipEdge = viewProjection.TransformFVector4( FVector4( center + FVector( radius, 0.0, 0.0 ), 1.0 ) );
+	if ( clipCenter.W <= 0.0 || clipEdge.W <= 0.0 )
+	{
+		return EUnitLodTier::Far;
+	}
+
+	const double dx = ( clipEdge.X / clipEdge.W - clipCenter.X / clipCenter.W ) * viewState.ViewRect.Width() * 0.5;
+	const double dy = ( clipEdge.Y / clipEdge.W - clipCenter.Y / clipCenter.W ) * viewState.ViewRect.Height() * 0.5;
+	const double screenRadius = FMath::Sqrt( dx * dx + dy * dy );
+
+	if ( screenRadius >= cNearScreenRadius )
+	{
+		return EUnitLodTier::Near;
+	}
+	return screenRadius >= cFarScreenRadius ? EUnitLodTier::Mid : EUnitLodTier::Far;
+}
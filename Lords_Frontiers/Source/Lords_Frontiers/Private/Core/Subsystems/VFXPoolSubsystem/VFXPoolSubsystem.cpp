@@ -0,0 +1,181 @@
+#include "Core/Subsystems/VFXPoolSubsystem/VFXPoolSubsystem.h"
+
+#include "Core/Subsystems/CameraViewSubsystem/CameraViewSubsystem.h"
+#include "VFX/EntityVFXConfig.h"
+
+#include "Engine/World.h"
+#include "NiagaraComponent.h"
+#include "NiagaraFunctionLibrary.h"
+#include "NiagaraSystem.h"
+
+namespace
+{
+	// Effects projecting to fewer pixels than this are not worth a component.
+	constexpr double cMinScreenRadius = 3.0;
+}
+
+void UVFXPoolSubsystem::Deinitialize()
+{
+	// Pooled components belong to the world's Niagara pool and are cleaned up with it
+	ActiveCounts_.Empty();
+	TotalActive_ = 0;
+
+	Super::Deinitialize();
+}
+
+UNiagaraComponent* UVFXPoolSubsystem::SpawnAtLocation(
+    UNiagaraSystem* system, const FVector& location, const FRotator& rotation, const FVector& scale,
+    const bool bCullable
+)
+{
+	if ( !system )
+	{
+		return nullptr;
+	}
+
+	if ( bCullable && !IsWorthSpawning( location ) )
+	{
+		++CulledCount_;
+		return nullptr;
+	}
+
+	int32& activeCount = ActiveCounts_.FindOrAdd( system );
+	if ( MaxActivePerSystem_ > 0 && activeCount >= MaxActivePerSystem_ )
+	{
+		++CulledCount_;
+		return nullptr;
+	}
+
+	UNiagaraComponent* component = UNiagaraFunctionLibrary::SpawnSystemAtLocation(
+	    this, system, location, rotation, scale, true, true, ENCPoolMethod::AutoRelease, true
+	);
+	if ( !component )
+	{
+		return nullptr;
+	}
+
+	++activeCount;
+	++TotalActive_;
+
+	// Removed again on finish: the component is shared with every other user of the pool
+	component->OnSystemFinished.AddUniqueDynamic( this, &UVFXPoolSubsystem::HandleSystemFinished );
+	return component;
+}
+
+void UVFXPoolSubsystem::PreWarm( UNiagaraSystem* system, const int32 count )
+{
+	if ( !system || count <= 0 )
+	{
+		return;
+	}
+
+	// Acquire all of them first so the pool hands out distinct components, then return them inactive
+	TArray<UNiagaraComponent*> components;
+	components.Reserve( count );
+	for ( int32 i = 0; i < count; ++i )
+	{
+		if ( UNiagaraComponent* component = UNiagaraFunctionLibrary::SpawnSystemAtLocation(
+		         this, system, FVector::ZeroVector, FRotator::ZeroRotator, FVector( 1.0f ), false, false,
+		         ENCPoolMethod::ManualRelease, false
+		     ) )
+		{
+			components.Add( component );
+		}
+	}
+
+	for ( UNiagaraComponent* component : components )
+	{
+		component->ReleaseToPool();
+	}
+}
+
+void UVFXPoolSubsystem::PreWarmFromConfig( const UEntityVFXConfig& config )
+{
+	MaxActivePerSystem_ = config.VFXMaxActivePerSystem;
+	CullRadius_ = config.VFXCullRadius;
+
+	TSet<UNiagaraSystem*> systems;
+	systems.Add( config.DefaultUnitSpawnVFX );
+	systems.Add( config.DefaultUnitDeathVFX );
+	systems.Add( config.DefaultUnitHitVFX );
+	systems.Add( config.DefaultUnitSpawnAbilityVFX );
+	systems.Add( config.DefaultBuildingHitVFX );
+	systems.Add( config.DefaultBuildingDestructionVFX );
+	systems.Add( config.DefaultBuildingConstructionVFX );
+	systems.Add( config.DefaultProjectileImpactVFX );
+
+	for ( const TPair<TSubclassOf<AUnit>, FUnitVFXOverride>& pair : config.UnitOverrides )
+	{
+		systems.Add( pair.Value.SpawnVFX );
+		systems.Add( pair.Value.DeathVFX );
+		systems.Add( pair.Value.HitVFX );
+		systems.Add( pair.Value.SpawnAbilityVFX );
+	}
+
+	for ( const TPair<TSubclassOf<ABuilding>, FBuildingVFXOverride>& pair : config.BuildingOverrides )
+	{
+		systems.Add( pair.Value.HitVFX );
+		systems.Add( pair.Value.DestructionVFX );
+		systems.Add( pair.Value.ConstructionVFX );
+	}
+
+	for ( const TPair<EProjectileType, FProjectileImpactVFX>& pair : config.ProjectileVFXOverrides )
+	{
+		systems.Add( pair.Value.ImpactVFX );
+		systems.Add( pair.Value.GroundImpactVFX );
+	}
+
+	for ( UNiagaraSystem* system : systems )
+	{
+		const int32* warmupOverride = config.VFXPoolWarmupOverrides.Find( system );
+		PreWarm( system, warmupOverride ? *warmupOverride : config.VFXPoolWarmupCount );
+	}
+}
+
+int32 UVFXPoolSubsystem::GetActiveCount( const UNiagaraSystem* system ) const
+{
+	return ActiveCounts_.FindRef( system );
+}
+
+bool UVFXPoolSubsystem::IsWorthSpawning( const FVector& location ) const
+{
+	const FCameraViewState* viewState = UCameraViewSubsystem::FindState( this );
+	if ( !viewState || !viewState->bHasView )
+	{
+		return true;
+	}
+
+	if ( !viewState->Frustum.IntersectSphere( location, CullRadius_ ) )
+	{
+		return false;
+	}
+
+	const FMatrix& viewProjection = viewState->ViewProjectionMatrix;
+	const FVector4 clipCenter = viewProjection.TransformFVector4( FVector4( location, 1.0 ) );
+	const FVector4 clipEdge =
+	    viewProjection.TransformFVector4( FVector4( location + FVector( CullRadius_, 0.0, 0.0 ), 1.0 ) );
+	if ( clipCenter.W <= 0.0 || clipEdge.W <= 0.0 )
+	{
+		return true;
+	}
+
+	const double dx = ( clipEdge.X / clipEdge.W - clipCenter.X / clipCenter.W ) * viewState->ViewRect.Width() * 0.5;
+	const double dy = ( clipEdge.Y / clipEdge.W - clipCenter.Y / clipCenter.W ) * viewState->ViewRect.Height() * 0.5;
+	return dx * dx + dy * dy >= cMinScreenRadius * cMinScreenRadius;
+}
+
+void UVFXPoolSubsystem::HandleSystemFinished( UNiagaraComponent* component )
+{
+	if ( !IsValid( component ) )
+	{
+		return;
+	}
+
+	component->OnSystemFinished.RemoveDynamic( this, &UVFXPoolSubsystem::HandleSystemFinished );
+
+	if ( int32* activeCount = ActiveCounts_.Find( component->GetAsset() ) )
+	{
+		*activeCount = FMath::Max( 0, *activeCount - 1 );
+		TotalActive_ = FMath::Max( 0, TotalActive_ - 1 );
+	}
+}
@@ -229,6 +229,269 @@ void FEntityStats::AddBurstDelay( float burstDelay )
 	SetBurstDelay( BurstDelay_ + burstDelay );
 }
 
+// compiled stat access
+
+bool FEntityStats::FindStat( FName propertyName, EStatsType& outStat )
+{
+	static const TMap<FName, EStatsType> statByName = []
+	{
+		TMap<FName, EStatsType> result;
+		for ( uint8 i = 0; i < static_cast<uint8>( EStatsType::Count ); ++i )
+		{
+			const EStatsType statType = static_cast<EStatsType>( i );
+			result.Add( GetStatPropertyName( statType ), statType );
+		}
+		return result;
+	}();
+
+	if ( const EStatsType* found = statByName.Find( propertyName ) )
+	{
+		outStat = *found;
+		return true;
+	}
+	return false;
+}
+
+FName FEntityStats::GetStatPropertyName( EStatsType statType )
+{
+	switch ( statType )
+	{
+	case EStatsType::MaxHealth:
+		return GET_MEMBER_NAME_CHECKED( FEntityStats, MaxHealth_ );
+	case EStatsType::AttackRange:
+		return GET_MEMBER_NAME_CHECKED( FEntityStats, AttackRange_ );
+	case EStatsType::AttackDamage:
+		return GET_MEMBER_NAME_CHECKED( FEntityStats, AttackDamage_ );
+	case EStatsType::AttackCooldown:
+		return GET_MEMBER_NAME_CHECKED( FEntityStats, AttackCooldown_ );
+	case EStatsType::MaxSpeed:
+		return GET_MEMBER_NAME_CHECKED( FEntityStats, MaxSpeed_ );
+	case EStatsType::SplashRadius:
+		return GET_MEMBER_NAME_CHECKED( FEntityStats, SplashRadius_ );
+	case EStatsType::BurstCount:
+		return GET_MEMBER_NAME_CHECKED( FEntityStats, BurstCount_ );
+	case EStatsType::BurstDelay:
+		return GET_MEMBER_NAME_CHECKED( FEntityStats, BurstDelay_ );
+	case EStatsType::CritChance:
+		return GET_MEMBER_NAME_CHECKED( FEntityStats, CritChance_ );
+	case EStatsType::CritDamageBonus:
+		return GET_MEMBER_NAME_CHECKED( FEntityStats, CritDamageBonus_ );
+	default:
+		return NAME_None;
+	}
+}
+
+double FEntityStats::GetStatValue( EStatsType statType ) const
+{
+	switch ( statType )
+	{
+	case EStatsType::MaxHealth:
+		return MaxHealth_;
+	case EStatsType::AttackRange:
+		return AttackRange_;
+	case EStatsType::AttackDamage:
+		return AttackDamage_;
+	case EStatsType::AttackCooldown:
+		return AttackCooldown_;
+	case EStatsType::MaxSpeed:
+		return MaxSpeed_;
+	case EStatsType::SplashRadius:
+		return SplashRadius_;
+	case EStatsType::BurstCount:
+		return BurstCount_;
+	case EStatsType::BurstDelay:
+		return BurstDelay_;
+	case EStatsType::CritChance:
+		return CritChance_;
+	case EStatsType::CritDamageBonus:
+		return CritDamageBonus_;
+	default:
+		return 0.0;
+	}
+}
+
+void FEntityStats::SetStatValue( EStatsType statType, double value )
+{
+	switch ( statType )
+	{
+	case EStatsType::MaxHealth:
+		// same rules as AddMaxHealth: growing heals to full, shrinking keeps the percentage
+		if ( const int delta = FMath::RoundToInt( value ) - MaxHealth_; delta != 0 )
+		{
+			AddMaxHealth( delta );
+		}
+		break;
+	case EStatsType::AttackRange:
+		SetAttackRange( value );
+		break;
+	case EStatsType::AttackDamage:
+		SetAttackDamage( FMath::RoundToInt( value ) );
+		break;
+	case EStatsType::AttackCooldown:
+		SetAttackCooldown( value );
+		break;
+	case EStatsType::MaxSpeed:
+		SetMaxSpeed( value );
+		break;
+	case EStatsType::SplashRadius:
+		SetSplashRadius( value );
+		break;
+	case EStatsType::BurstCount:
+		SetBurstCount( FMath::RoundToInt( value ) );
+		break;
+	case EStatsType::BurstDelay:
+		SetBurstDelay( value );
+		break;
+	case EStatsType::CritChance:
+		CritChance_ = FMath::Clamp( FMath::RoundToInt( value ), 0, 100 );
+		break;
+	case EStatsType::CritDamageBonus:
+		CritDamageBonus_ = FMath::Max( FMath::RoundToInt( value ), 0 );
+		break;
+	default:
+		break;
+	}
+}
+
+// modifier stack
+
+void FEntityStats::SetModifier(
+    EStatsType statType, const FStatModifierSource& source, float value, EStatModifierLayer layer
+)
+{
+	if ( layer == EStatModifierLayer::Additive && FMath::IsNearlyZero( value ) )
+	{
+		RemoveModifier( statType, source );
+		return;
+	}
+
+	FStatModifier& modifier = FindOrAddLayers( statType ).Modifiers.FindOrAdd( source );
+	if ( modifier.Layer == layer && modifier.Value == value && modifier.Count == 1 )
+	{
+		return;
+	}
+
+	modifier.Layer = layer;
+	modifier.Value = value;
+	modifier.Count = 1;
+	MarkStatDirty( statType );
+}
+
+void FEntityStats::RemoveModifier( EStatsType statType, const FStatModifierSource& source )
+{
+	FStatModifierLayers* layers = ModifierLayers_.Find( statType );
+	if ( layers && layers->Modifiers.Remove( source ) > 0 )
+	{
+		MarkStatDirty( statType );
+	}
+}
+
+void FEntityStats::PushModifier(
+    EStatsType statType, const FStatModifierSource& source, float value, EStatModifierLayer layer
+)
+{
+	FStatModifierLayers& layers = FindOrAddLayers( statType );
+	if ( FStatModifier* existing = layers.Modifiers.Find( source ) )
+	{
+		ensureMsgf(
+		    existing->Layer == layer && existing->Value == value,
+		    TEXT( "PushModifier: one source pushed different values on the same stat" )
+		);
+		++existing->Count;
+	}
+	else
+	{
+		layers.Modifiers.Add( source, { layer, value, 1 } );
+	}
+	MarkStatDirty( statType );
+}
+
+void FEntityStats::PopModifier( EStatsType statType, const FStatModifierSource& source )
+{
+	FStatModifierLayers* layers = ModifierLayers_.Find( statType );
+	FStatModifier* modifier = layers ? layers->Modifiers.Find( source ) : nullptr;
+	if ( !modifier )
+	{
+		return;
+	}
+
+	if ( --modifier->Count <= 0 )
+	{
+		layers->Modifiers.Remove( source );
+	}
+	MarkStatDirty( statType );
+}
+
+void FEntityStats::BeginModifierBatch()
+{
+	++ModifierBatchDepth_;
+}
+
+void FEntityStats::EndModifierBatch()
+{
+	if ( ModifierBatchDepth_ == 0 || --ModifierBatchDepth_ > 0 )
+	{
+		return;
+	}
+
+	while ( DirtyStats_ != 0 )
+	{
+		const uint32 bit = FMath::CountTrailingZeros( DirtyStats_ );
+		DirtyStats_ &= DirtyStats_ - 1;
+		ResolveStat( static_cast<EStatsType>( bit ) );
+	}
+}
+
+void FEntityStats::MarkStatDirty( EStatsType statType )
+{
+	if ( ModifierBatchDepth_ > 0 )
+	{
+		DirtyStats_ |= 1u << static_cast<uint32>( statType );
+		return;
+	}
+	ResolveStat( statType );
+}
+
+FStatModifierLayers& FEntityStats::FindOrAddLayers( EStatsType statType )
+{
+	if ( FStatModifierLayers* layers = ModifierLayers_.Find( statType ) )
+	{
+		return *layers;
+	}
+
+	FStatModifierLayers& layers = ModifierLayers_.Add( statType );
+	layers.Base = GetStatValue( statType );
+	layers.Applied = layers.Base;
+	return layers;
+}
+
+void FEntityStats::ResolveStat( EStatsType statType )
+{
+	FStatModifierLayers* layers = ModifierLayers_.Find( statType );
+	if ( !layers )
+	{
+		return;
+	}
+
+	// Upgrades and spawn buffs write stats directly; fold what they changed into the base.
+	const double current = GetStatValue( statType );
+	if ( current != layers->Applied )
+	{
+		layers->Base += current - layers->Applied;
+	}
+
+	if ( layers->Modifiers.IsEmpty() )
+	{
+		const double base = layers->Base;
+		ModifierLayers_.Remove( statType );
+		SetStatValue( statType, base );
+		return;
+	}
+
+	SetStatValue( statType, layers->Evaluate() );
+	layers->Applied = GetStatValue( statType );
+}
+
 int FEntityStats::ApplyDamage( int damage )
 {
 	if ( damage <= 0 || Health_ <= 0 )
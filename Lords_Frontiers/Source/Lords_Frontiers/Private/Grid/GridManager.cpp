@@ -158,8 +158,7 @@ FIntPoint AGridManager::FindClosestWalkableCellCoords( FVector location ) const
 
 	auto processCell = [this, &closestCoords, &location, &distToClosest, &found]( const FIntPoint coords )
 	{
-		const FGridCell* cell = GetCell( coords.X, coords.Y );
-		if ( cell && cell->bIsWalkable )
+		if ( IsWalkableFast( coords.X, coords.Y ) )
 		{
 			FVector cellLocation;
 			GetCellWorldCenter( coords, cellLocation );
@@ -217,72 +216,6 @@ FIntPoint AGridManager::GetCellCoordsRaw( FVector location ) const
 	return FIntPoint( x, y );
 }
 
-TArray<FGridCell*> AGridManager::GetCellsInCross( const FIntPoint& myCell, const int32 radius )
-{
-	TArray<FGridCell*> cellNeighbors;
-
-	const int32 cx = myCell.X;
-	const int32 cy = myCell.Y;
-
-	for ( int32 i = 1; i <= radius; ++i )
-	{
-		if ( IsValidCoords( cx + i, cy ) )
-		{
-			cellNeighbors.Add( GetCell( cx + i, cy ) );
-		}
-		if ( IsValidCoords( cx - i, cy ) )
-		{
-			cellNeighbors.Add( GetCell( cx - i, cy ) );
-		}
-		if ( IsValidCoords( cx, cy + i ) )
-		{
-			cellNeighbors.Add( GetCell( cx, cy + i ) );
-		}
-		if ( IsValidCoords( cx, cy - i ) )
-		{
-			cellNeighbors.Add( GetCell( cx, cy - i ) );
-		}
-	}
-	return cellNeighbors;
-}
-
-TArray<FGridCell*> AGridManager::GetCellsInSquare( const FIntPoint& myCell, const int32 radius )
-{
-	TArray<FGridCell*> cellNeighbors;
-	const int32 cx = myCell.X;
-	const int32 cy = myCell.Y;
-	for ( int32 dy = -radius; dy <= radius; ++dy )
-	{
-		for ( int32 dx = -radius; dx <= radius; ++dx )
-		{
-			if ( dx == 0 && dy == 0 )
-			{
-				continue;
-			}
-			const int32 x = cx + dx;
-			const int32 y = cy + dy;
-			if ( IsValidCoords( x, y ) )
-			{
-				cellNeighbors.Add( GetCell( x, y ) );
-			}
-		}
-	}
-	return cellNeighbors;
-}
-
-TArray<FGridCell*> AGridManager::GetCellsByShape( const FIntPoint& myCell, const int32 radius, EBonusShape shape )
-{
-	switch ( shape )
-	{
-	case EBonusShape::Cross:
-		return GetCellsInCross( myCell, radius );
-	case EBonusShape::Square:
-		return GetCellsInSquare( myCell, radius );
-	default:
-		return GetCellsInCross( myCell, radius );
-	}
-}
-
 void AGridManager::InitializeGrid()
 {
 	const int32 height = GetGridHeight();
@@ -318,4 +251,92 @@ void AGridManager::InitializeGrid()
 			}
 		}
 	}
+
+	RebuildRuntimeMirror();
+}
+
+void AGridManager::RebuildRuntimeMirror()
+{
+	RuntimeHeight_ = GetGridHeight();
+	RuntimeStride_ = GetMaxWidth();
+
+	const int32 total = RuntimeStride_ * RuntimeHeight_;
+
+	DenseCells_.Init( nullptr, total );
+	Occupants_.Init( nullptr, total );
+	ValidBits_.Init( false, total );
+	WalkableBits_.Init( false, total );
+	BuildableBits_.Init( false, total );
+	OccupiedBits_.Init( false, total );
+
+	for ( int32 y = 0; y < RuntimeHeight_; ++y )
+	{
+		TArray<FGridCell>& cells = GridRows_[y].Cells;
+		for ( int32 x = 0; x < cells.Num(); ++x )
+		{
+			const int32 index = y * RuntimeStride_ + x;
+			DenseCells_[index] = &cells[x];
+			ValidBits_[index] = true;
+			SyncRuntimeCell( x, y );
+		}
+	}
+}
+
+void AGridManager::SyncRuntimeCell( const int32 x, const int32 y )
+{
+	if ( !IsValidCoordsFast( x, y ) )
+	{
+		return;
+	}
+
+	const int32 index = y * RuntimeStride_ + x;
+	const FGridCell& cell = *DenseCells_[index];
+
+	WalkableBits_[index] = cell.bIsWalkable;
+	BuildableBits_[index] = cell.bIsBuildable;
+	OccupiedBits_[index] = cell.bIsOccupied;
+	Occupants_[index] = cell.Occupant;
+}
+
+void AGridManager::SetCellOccupant( const FIntPoint& coords, ABuilding* occupant )
+{
+	FGridCell* cell = GetCell( coords.X, coords.Y );
+	if ( !cell )
+	{
+		return;
+	}
+
+	cell->Occupant = occupant;
+	cell->bIsOccupied = occupant != nullptr;
+	SyncRuntimeCell( coords.X, coords.Y );
+}
+
+void AGridManager::ClearCellOccupant( const FIntPoint& coords, const ABuilding* expectedOccupant )
+{
+	FGridCell* cell = GetCell( coords.X, coords.Y );
+	if ( !cell || cell->Occupant.Get() != expectedOccupant )
+	{
+		return;
+	}
+
+	cell->ResetRuntimeState();
+	SyncRuntimeCell( coords.X, coords.Y );
+}
+
+void AGridManager::SetCellWalkable( const FIntPoint& coords, const bool bWalkable )
+{
+	if ( FGridCell* cell = GetCell( coords.X, coords.Y ) )
+	{
+		cell->bIsWalkable = bWalkable;
+		SyncRuntimeCell( coords.X, coords.Y );
+	}
+}
+
+void AGridManager::SetCellBuildable( const FIntPoint& coords, const bool bBuildable )
+{
+	if ( FGridCell* cell = GetCell( coords.X, coords.Y ) )
+	{
+		cell->bIsBuildable = bBuildable;
+		SyncRuntimeCell( coords.X, coords.Y );
+	}
 }
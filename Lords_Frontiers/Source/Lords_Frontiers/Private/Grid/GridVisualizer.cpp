@@ -45,8 +45,6 @@ void AGridVisualizer::BeginPlay()
 		    Cast<AGridManager>( UGameplayStatics::GetActorOfClass( GetWorld(), AGridManager::StaticClass() ) );
 	}
 
-	SetActorHiddenInGame( !bGridVisible_ );
-
 	if ( BuildableMesh_ )
 	{
 		BuildableMesh_->SetVisibility( bGridVisible_, true );
@@ -64,19 +62,14 @@ void AGridVisualizer::BeginPlay()
 
 void AGridVisualizer::ShowBonusHighlight( const TArray<FIntPoint>& cells, UMaterialInterface* material )
 {
-	UE_LOG(
-	    LogTemp, Warning, TEXT( "ShowBonusHighlight: cells=%d, material=%s" ), cells.Num(),
-	    material ? *material->GetName() : TEXT( "NULL" )
-	);
 	if ( !BonusHighlightMesh_ || !GridManager_ )
 	{
 		return;
 	}
 
-	BonusHighlightMesh_->ClearInstances();
-
 	if ( !material )
 	{
+		HideBonusHighlight();
 		return;
 	}
 
@@ -87,37 +80,88 @@ void AGridVisualizer::ShowBonusHighlight( const TArray<FIntPoint>& cells, UMater
 		BonusHighlightMesh_->SetStaticMesh( BuildableMesh_->GetStaticMesh() );
 	}
 
-	const float cellSize = GridManager_->GetCellSize();
-	const FVector origin = GridManager_->GetActorLocation();
-	const float z = origin.Z + ZOffset_ + 0.5f;
-
-	const float baseScale = cellSize / 100.0f;
-	const FVector scale3D( baseScale * MeshScale_ );
-
+	TSet<FIntPoint> wanted;
+	wanted.Reserve( cells.Num() );
 	for ( const FIntPoint& coord : cells )
 	{
-		const float centerX = origin.X + ( static_cast<float>( coord.X ) + 0.5f ) * cellSize;
-		const float centerY = origin.Y + ( static_cast<float>( coord.Y ) + 0.5f ) * cellSize;
+		wanted.Add( coord );
+	}
+
+	bool bChanged = false;
+	for ( auto it = HighlightInstanceByCell_.CreateIterator(); it; ++it )
+	{
+		if ( !wanted.Contains( it.Key() ) )
+		{
+			// Parked at zero scale and reused by the next cell that lights up
+			BonusHighlightMesh_->UpdateInstanceTransform(
+			    it.Value(), MakeHighlightTransform( it.Key(), false ), false, false, true
+			);
+			FreeHighlightInstances_.Add( it.Value() );
+			it.RemoveCurrent();
+			bChanged = true;
+		}
+	}
 
-		const FVector location( centerX, centerY, z );
-		const FTransform instanceTransform( FRotator::ZeroRotator, location, scale3D );
+	for ( const FIntPoint& coord : wanted )
+	{
+		if ( HighlightInstanceByCell_.Contains( coord ) )
+		{
+			continue;
+		}
 
-		BonusHighlightMesh_->AddInstance( instanceTransform );
+		const FTransform transform = MakeHighlightTransform( coord, true );
+		int32 instanceIndex;
+		if ( FreeHighlightInstances_.Num() > 0 )
+		{
+			instanceIndex = FreeHighlightInstances_.Pop( EAllowShrinking::No );
+			BonusHighlightMesh_->UpdateInstanceTransform( instanceIndex, transform, false, false, true );
+		}
+		else
+		{
+			instanceIndex = BonusHighlightMesh_->AddInstance( transform, false );
+		}
+		HighlightInstanceByCell_.Add( coord, instanceIndex );
+		bChanged = true;
 	}
 
+	if ( bChanged )
+	{
+		BonusHighlightMesh_->MarkRenderStateDirty();
+	}
 	BonusHighlightMesh_->SetVisibility( true );
-
-	UE_LOG( LogTemp, Warning, TEXT( "BonusHighlight instances added: %d" ), BonusHighlightMesh_->GetInstanceCount() );
 }
 
 void AGridVisualizer::HideBonusHighlight()
 {
-	if ( BonusHighlightMesh_ )
+	if ( !BonusHighlightMesh_ )
+	{
+		return;
+	}
+
+	// Instances are kept for the next highlight; hiding the component is enough
+	for ( const TPair<FIntPoint, int32>& pair : HighlightInstanceByCell_ )
 	{
-		BonusHighlightMesh_->ClearInstances();
-		BonusHighlightMesh_->SetVisibility( false );
+		BonusHighlightMesh_->UpdateInstanceTransform(
+		    pair.Value, MakeHighlightTransform( pair.Key, false ), false, false, true
+		);
+		FreeHighlightInstances_.Add( pair.Value );
 	}
+	if ( HighlightInstanceByCell_.Num() > 0 )
+	{
+		BonusHighlightMesh_->MarkRenderStateDirty();
+	}
+	HighlightInstanceByCell_.Reset();
+
+	BonusHighlightMesh_->SetVisibility( false );
 }
+
+FTransform AGridVisualizer::MakeHighlightTransform( const FIntPoint& coords, const bool bVisible ) const
+{
+	FTransform transform = MakeCellTransform( coords, bVisible );
+	transform.AddToTranslation( FVector( 0.0, 0.0, 0.5 ) );
+	return transform;
+}
+
 void AGridVisualizer::ShowGrid()
 {
 	SetGridVisible( true );
@@ -142,20 +186,16 @@ void AGridVisualizer::SetGridVisible( const bool bVisible )
 		return;
 	}
 
+	// Instances are kept while hidden so showing the grid again only syncs changed cells. Only the grid
+	// components are hidden: the bonus highlight has its own visibility.
 	if ( !bGridVisible_ )
 	{
-
-		BuildableMesh_->ClearInstances();
-		BlockedMesh_->ClearInstances();
-
 		BuildableMesh_->SetVisibility( false, true );
 		BlockedMesh_->SetVisibility( false, true );
-		SetActorHiddenInGame( true );
 
 		return;
 	}
 
-	SetActorHiddenInGame( false );
 	BuildableMesh_->SetVisibility( true, true );
 	BlockedMesh_->SetVisibility( true, true );
 
@@ -170,59 +210,121 @@ void AGridVisualizer::RefreshGrid()
 	}
 
 	const int32 height = GridManager_->GetGridHeight();
-
+	const int32 width = GridManager_->GetGridWidth();
 	if ( height <= 0 )
 	{
 		return;
 	}
 
-	const float cellSize = GridManager_->GetCellSize();
-	const FVector origin = GridManager_->GetActorLocation();
-	const float z = origin.Z + ZOffset_;
+	if ( !bInstancesBuilt_ || height != LayoutHeight_ || width != LayoutStride_ )
+	{
+		BuildInstances();
+		return;
+	}
+
+	bool bChanged = false;
+	for ( int32 y = 0; y < height; ++y )
+	{
+		const int32 rowWidth = GridManager_->GetRowWidth( y );
+		for ( int32 x = 0; x < rowWidth; ++x )
+		{
+			const FIntPoint coords( x, y );
+			bChanged |= SyncCellInstance( DenseIndex( coords ), coords );
+		}
+	}
+
+	if ( bChanged )
+	{
+		BuildableMesh_->MarkRenderStateDirty();
+		BlockedMesh_->MarkRenderStateDirty();
+	}
+}
+
+void AGridVisualizer::BuildInstances()
+{
+	bInstancesBuilt_ = false;
 
 	BuildableMesh_->ClearInstances();
 	BlockedMesh_->ClearInstances();
 
+	LayoutHeight_ = GridManager_->GetGridHeight();
+	LayoutStride_ = GridManager_->GetGridWidth();
+
+	const int32 total = LayoutStride_ * LayoutHeight_;
+	CellToInstance_.Init( INDEX_NONE, total );
+	CachedBuildable_.Init( false, total );
+
 	if ( !BuildableMesh_->GetStaticMesh() || !BlockedMesh_->GetStaticMesh() )
 	{
 		UE_LOG( LogTemp, Warning, TEXT( "GridVisualizer: StaticMesh not assigned on components" ) );
 		return;
 	}
 
-	for ( int32 y = 0; y < height; ++y )
+	TArray<FTransform> buildableTransforms;
+	TArray<FTransform> blockedTransforms;
+	buildableTransforms.Reserve( total );
+	blockedTransforms.Reserve( total );
+
+	for ( int32 y = 0; y < LayoutHeight_; ++y )
 	{
 		const int32 rowWidth = GridManager_->GetRowWidth( y );
-
 		for ( int32 x = 0; x < rowWidth; ++x )
 		{
+			const FIntPoint coords( x, y );
 			const FGridCell* cell = GridManager_->GetCell( x, y );
 			if ( !cell )
 			{
 				continue;
 			}
 
-			const float centerX = origin.X + ( static_cast<float>( x ) + 0.5f ) * cellSize;
-			const float centerY = origin.Y + ( static_cast<float>( y ) + 0.5f ) * cellSize;
-
-			const FVector location( centerX, centerY, z );
+			const int32 denseIndex = DenseIndex( coords );
+			CellToInstance_[denseIndex] = buildableTransforms.Num();
+			CachedBuildable_[denseIndex] = cell->bIsBuildable;
 
-			const FRotator rotation = FRotator::ZeroRotator;
+			buildableTransforms.Add( MakeCellTransform( coords, cell->bIsBuildable ) );
+			blockedTransforms.Add( MakeCellTransform( coords, !cell->bIsBuildable ) );
+		}
+	}
 
-			const float baseScale = cellSize / 100.0f;
-			const FVector scale3D( baseScale * MeshScale_ );
+	BuildableMesh_->AddInstances( buildableTransforms, false );
+	BlockedMesh_->AddInstances( blockedTransforms, false );
 
-			const FTransform instanceTransform( rotation, location, scale3D );
+	bInstancesBuilt_ = true;
+}
 
-			if ( cell->bIsBuildable )
-			{
-				BuildableMesh_->AddInstance( instanceTransform );
-			}
-			else
-			{
-				BlockedMesh_->AddInstance( instanceTransform );
-			}
-		}
+bool AGridVisualizer::SyncCellInstance( const int32 denseIndex, const FIntPoint& coords )
+{
+	const FGridCell* cell = GridManager_->GetCell( coords.X, coords.Y );
+	const int32 instanceIndex = CellToInstance_.IsValidIndex( denseIndex ) ? CellToInstance_[denseIndex] : INDEX_NONE;
+	if ( !cell || instanceIndex == INDEX_NONE || CachedBuildable_[denseIndex] == cell->bIsBuildable )
+	{
+		return false;
 	}
+
+	CachedBuildable_[denseIndex] = cell->bIsBuildable;
+	BuildableMesh_->UpdateInstanceTransform(
+	    instanceIndex, MakeCellTransform( coords, cell->bIsBuildable ), false, false, true
+	);
+	BlockedMesh_->UpdateInstanceTransform(
+	    instanceIndex, MakeCellTransform( coords, !cell->bIsBuildable ), false, false, true
+	);
+	return true;
+}
+
+FTransform AGridVisualizer::MakeCellTransform( const FIntPoint& coords, const bool bVisible ) const
+{
+	const float cellSize = GridManager_->GetCellSize();
+	const FVector origin = GridManager_->GetActorLocation();
+
+	const float centerX = origin.X + ( static_cast<float>( coords.X ) + 0.5f ) * cellSize;
+	const float centerY = origin.Y + ( static_cast<float>( coords.Y ) + 0.5f ) * cellSize;
+	const FVector location( centerX, centerY, origin.Z + ZOffset_ );
+
+	// Zero scale hides the instance and skips its collision body.
+	const float baseScale = cellSize / 100.0f;
+	const FVector scale3D = bVisible ? FVector( baseScale * MeshScale_ ) : FVector::ZeroVector;
+
+	return FTransform( FRotator::ZeroRotator, location, scale3D );
 }
 
 bool AGridVisualizer::GetCellWorldCenter( const FIntPoint& cellCoords, FVector& outLocation ) const
@@ -54,7 +54,7 @@ void UMatchResultsWidget::HandleMainMenuClicked()
 {
 	if ( UGameInstance* gi = GetGameInstance() )
 	{
-		if ( const ULevelSubsystem* levels = gi->GetSubsystem<ULevelSubsystem>() )
+		if ( ULevelSubsystem* levels = gi->GetSubsystem<ULevelSubsystem>() )
 		{
 			levels->LoadMainMenu();
 		}
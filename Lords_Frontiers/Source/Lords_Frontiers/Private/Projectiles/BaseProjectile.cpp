@@ -6,10 +6,11 @@
 #include "VFX/EntityVFXConfig.h"
 #include "Core/Subsystems/ProjectilePoolSubsystem/ProjectilePoolSubsystem.h"
 #include "Core/Subsystems/SessionLogger/DamageEvent.h"
+#include "Core/Subsystems/VFXPoolSubsystem/VFXPoolSubsystem.h"
 #include "DrawDebugHelpers.h"
 #include "Entity.h"
 #include "NiagaraComponent.h"
-#include "NiagaraFunctionLibrary.h"
+#include "Utilities/GameplayStats.h"
 #include "Utilities/TraceChannelMappings.h"
 
 #include "Components/MeshComponent.h"
@@ -344,9 +345,10 @@ void ABaseProjectile::Tick( float deltaTime )
 			{
 				if ( UNiagaraSystem* groundVFX = GetProjectileImpactVFX( true ) )
 				{
-					UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-					    GetWorld(), groundVFX, ImpactLocation, GetActorRotation()
-					);
+					if ( UVFXPoolSubsystem* vfxPool = GetWorld()->GetSubsystem<UVFXPoolSubsystem>() )
+					{
+						vfxPool->SpawnAtLocation( groundVFX, ImpactLocation, GetActorRotation() );
+					}
 				}
 			}
 
@@ -417,6 +419,8 @@ void ABaseProjectile::OnCollisionStart(
 
 void ABaseProjectile::DealDamage( AActor* hitActor ) const
 {
+	LF_SCOPE_CYCLE_COUNTER( DealDamage );
+
 	if ( hitActor )
 	{
 		if ( IEntity* target = Cast<IEntity>( hitActor ) )
@@ -587,5 +591,8 @@ void ABaseProjectile::SpawnHitVFX( AActor* hitActor, const FVector& impactLocati
 		return;
 	}
 
-	UNiagaraFunctionLibrary::SpawnSystemAtLocation( GetWorld(), hitVFX, impactLocation, GetActorRotation() );
+	if ( UVFXPoolSubsystem* vfxPool = GetWorld()->GetSubsystem<UVFXPoolSubsystem>() )
+	{
+		vfxPool->SpawnAtLocation( hitVFX, impactLocation, GetActorRotation() );
+	}
 }
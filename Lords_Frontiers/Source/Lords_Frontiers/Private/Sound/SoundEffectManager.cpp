@@ -4,6 +4,8 @@
 #include "Core/DefaultGameInstance.h"
 
 #include "Components/AudioComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
 #include "Kismet/GameplayStatics.h"
 #include "Sound/AudioSettingsSubsystem.h"
 #include "Sound/Data/SoundDataAsset.h"
@@ -45,32 +47,45 @@ void USoundEffectManager::Initialize( FSubsystemCollectionBase& collection )
 		SoundData_ = gi->SoundData;
 		DefaultAttenuation_ = gi->DefaultAttenuation;
 	}
+	WorldCleanupHandle_ = FWorldDelegates::OnWorldCleanup.AddUObject( this, &USoundEffectManager::HandleWorldCleanup );
 	Super::Initialize( collection );
 }
 
 void USoundEffectManager::Deinitialize()
 {
-	for ( TObjectPtr<UAudioComponent> audio : ComponentsInUsePool_ )
+	FWorldDelegates::OnWorldCleanup.Remove( WorldCleanupHandle_ );
+	WorldCleanupHandle_.Reset();
+	ResetVoices();
+
+	Super::Deinitialize();
+}
+
+void USoundEffectManager::HandleWorldCleanup( UWorld* world, bool /*bSessionEnded*/, bool /*bCleanupResources*/ )
+{
+	// Voices are outered to the level's world and never report finishing once it is torn down
+	if ( world && world->GetGameInstance() == GetGameInstance() )
 	{
-		if ( IsValid( audio ) )
-		{
-			audio->OnAudioFinishedNative.Clear();
-			audio->OnAudioFinished.Clear();
-		}
+		ResetVoices();
 	}
-	ComponentsInUsePool_.Empty();
+}
 
-	for ( TObjectPtr<UAudioComponent>& audio : FreeComponentsPool_ )
+void USoundEffectManager::ResetVoices()
+{
+	for ( TObjectPtr<UAudioComponent>& audio : Voices_ )
 	{
 		if ( IsValid( audio ) )
 		{
+			audio->OnAudioFinishedNative.Clear();
+			audio->OnAudioFinished.Clear();
 			audio->Stop();
 			audio->UnregisterComponent();
 		}
 	}
-	FreeComponentsPool_.Empty();
-
-	Super::Deinitialize();
+	Voices_.Empty();
+	VoiceStates_.Empty();
+	ActiveVoicesByTag_.Empty();
+	Last2DPlayTime_.Empty();
+	NextVoice_ = 0;
 }
 
 void USoundEffectManager::RegisterObject( UObject* object )
@@ -145,55 +160,172 @@ void USoundEffectManager::HandleAudioEvent( FAudioEvent event )
 	}
 }
 
-TWeakObjectPtr<UAudioComponent> USoundEffectManager::AcquireAudioComponent()
+double USoundEffectManager::CurrentTime() const
 {
-	UAudioComponent* component;
-	if ( FreeComponentsPool_.IsEmpty() )
+	// World real time restarts with every level; voice and 2D timestamps outlive it
+	return FPlatformTime::Seconds();
+}
+
+float USoundEffectManager::VoiceScore( const float priority, const FVector& location ) const
+{
+	// Priority halves every 20 m away from the listener
+	const double distance = FVector::Dist( location, ListenerLocation_ );
+	return priority / static_cast<float>( 1.0 + distance / 2000.0 );
+}
+
+int32 USoundEffectManager::FindCoalescingVoice(
+    const FSoundEntry& entry, const FGameplayTag& tag, const FVector& worldLocation
+) const
+{
+	if ( entry.CoalesceWindow <= 0.f )
 	{
-		component = NewObject<UAudioComponent>( GetWorld() );
-		UE_LOG(
-		    LogTemp, Log, TEXT( "USoundEffectManager: new UAudioComponent created. UAudioComponents in use: %d" ),
-		    ComponentsInUsePool_.Num()
-		);
+		return INDEX_NONE;
 	}
-	else
+
+	const double now = CurrentTime();
+	const double radiusSquared = FMath::Square( static_cast<double>( entry.CoalesceRadius ) );
+	for ( int32 i = 0; i < VoiceStates_.Num(); ++i )
+	{
+		const FSoundVoiceState& state = VoiceStates_[i];
+		if ( state.bActive && state.Tag == tag && now - state.StartTime <= entry.CoalesceWindow &&
+		     FVector::DistSquared( state.Location, worldLocation ) <= radiusSquared )
+		{
+			return i;
+		}
+	}
+	return INDEX_NONE;
+}
+
+int32 USoundEffectManager::FindVoiceToSteal( const FGameplayTag* tagFilter, float& outScore ) const
+{
+	int32 victim = INDEX_NONE;
+	outScore = TNumericLimits<float>::Max();
+	for ( int32 i = 0; i < VoiceStates_.Num(); ++i )
 	{
-		auto it = FreeComponentsPool_.CreateIterator();
-		auto value = *it;
-		it.RemoveCurrent();
-		component = value;
+		const FSoundVoiceState& state = VoiceStates_[i];
+		if ( !state.bActive || ( tagFilter && state.Tag != *tagFilter ) )
+		{
+			continue;
+		}
+		const float score = VoiceScore( state.Priority, state.Location );
+		if ( score < outScore )
+		{
+			outScore = score;
+			victim = i;
+		}
 	}
+	return victim;
+}
 
-	if ( component )
+UAudioComponent* USoundEffectManager::CreateVoiceComponent( const int32 voiceIndex )
+{
+	UAudioComponent* component = NewObject<UAudioComponent>( GetWorld() );
+	if ( !component )
 	{
-		ComponentsInUsePool_.Add( component );
+		return nullptr;
 	}
+
+	component->bAllowSpatialization = true;
+
+	TWeakObjectPtr<USoundEffectManager> weakThis = this;
+	component->OnAudioFinishedNative.AddLambda(
+	    [weakThis, voiceIndex]( UAudioComponent* finished )
+	    {
+		    if ( weakThis.IsValid() && IsValid( finished ) )
+		    {
+			    weakThis->OnVoiceFinished( voiceIndex, finished );
+		    }
+	    }
+	);
+
+	Voices_[voiceIndex] = component;
+	UE_LOG(
+	    LogTemp, Log, TEXT( "USoundEffectManager: new UAudioComponent created. Voices: %d" ), Voices_.Num()
+	);
 	return component;
 }
 
-void USoundEffectManager::ReleaseAudioComponent( TWeakObjectPtr<UAudioComponent> component )
+int32 USoundEffectManager::AcquireVoice(
+    const FSoundEntry& entry, const FGameplayTag& tag, const FVector& worldLocation
+)
 {
-	if ( !component.IsValid() )
+	const float newScore = VoiceScore( entry.Priority, worldLocation );
+
+	// Per-tag limit: replace the least important voice of this tag, or drop the new one
+	const int32 maxConcurrent =
+	    entry.MaxConcurrent > 0 ? entry.MaxConcurrent : ( SoundData_ ? SoundData_->DefaultMaxConcurrent() : 0 );
+	if ( maxConcurrent > 0 && ActiveVoicesByTag_.FindRef( tag ) >= maxConcurrent )
 	{
-		return;
+		float victimScore = 0.f;
+		const int32 victim = FindVoiceToSteal( &tag, victimScore );
+		if ( victim == INDEX_NONE || victimScore > newScore )
+		{
+			return INDEX_NONE;
+		}
+		StopVoice( victim );
+		return victim;
+	}
+
+	const int32 voiceCount = VoiceStates_.Num();
+	for ( int32 n = 0; n < voiceCount; ++n )
+	{
+		const int32 index = ( NextVoice_ + n ) % voiceCount;
+		if ( !VoiceStates_[index].bActive )
+		{
+			NextVoice_ = ( index + 1 ) % voiceCount;
+			return index;
+		}
 	}
 
-	component->Stop();
+	const int32 maxVoices = SoundData_ ? SoundData_->MaxVoices() : 32;
+	if ( voiceCount < maxVoices )
+	{
+		Voices_.AddDefaulted();
+		VoiceStates_.AddDefaulted();
+		return voiceCount;
+	}
 
-	component->OnAudioFinishedNative.Clear();
-	component->OnAudioFinished.Clear();
+	// Global budget: steal the least important voice if the new sound matters more
+	float victimScore = 0.f;
+	const int32 victim = FindVoiceToSteal( nullptr, victimScore );
+	if ( victim == INDEX_NONE || victimScore > newScore )
+	{
+		return INDEX_NONE;
+	}
+	StopVoice( victim );
+	return victim;
+}
 
-	component->SetSound( nullptr );
-	component->SetAttenuationSettings( nullptr );
-	component->Deactivate();
+void USoundEffectManager::StopVoice( const int32 voiceIndex )
+{
+	FSoundVoiceState& state = VoiceStates_[voiceIndex];
+	if ( state.bActive )
+	{
+		if ( int32* count = ActiveVoicesByTag_.Find( state.Tag ) )
+		{
+			*count = FMath::Max( 0, *count - 1 );
+		}
+	}
+	state.bActive = false;
 
-	ComponentsInUsePool_.Remove( component.Get() );
-	FreeComponentsPool_.Add( component.Get() );
+	if ( UAudioComponent* audio = Voices_[voiceIndex] )
+	{
+		audio->Stop();
+	}
 }
 
-void USoundEffectManager::OnSoundFinished( TWeakObjectPtr<UAudioComponent> component )
+void USoundEffectManager::OnVoiceFinished( const int32 voiceIndex, UAudioComponent* component )
 {
-	ReleaseAudioComponent( component );
+	// A stolen voice reports the old sound finishing after it already started the new one
+	if ( !Voices_.IsValidIndex( voiceIndex ) || Voices_[voiceIndex] != component || component->IsPlaying() )
+	{
+		return;
+	}
+
+	StopVoice( voiceIndex );
+	component->SetSound( nullptr );
+	component->SetAttenuationSettings( nullptr );
+	component->Deactivate();
 }
 
 void USoundEffectManager::Play2D( const FSoundEntry& entry, const FGameplayTag& tag )
@@ -203,6 +335,14 @@ void USoundEffectManager::Play2D( const FSoundEntry& entry, const FGameplayTag&
 		return;
 	}
 
+	const double now = CurrentTime();
+	double& lastPlayTime = Last2DPlayTime_.FindOrAdd( tag, -1.0 );
+	if ( lastPlayTime >= 0.0 && now - lastPlayTime < entry.CoalesceWindow )
+	{
+		return;
+	}
+	lastPlayTime = now;
+
 	const float categoryVolume = CategoryVolumeMultiplier( this, CategoryForTag( tag ) );
 	const float volume = FMath::RandRange( entry.VolumeRange.X, entry.VolumeRange.Y ) * categoryVolume;
 	const float pitch  = FMath::RandRange( entry.PitchRange.X, entry.PitchRange.Y );
@@ -229,19 +369,60 @@ void USoundEffectManager::Play2D( const FSoundEntry& entry, const FGameplayTag&
 
 void USoundEffectManager::Play3D( const FSoundEntry& entry, const FGameplayTag& tag, const FVector& worldLocation )
 {
-	UAudioComponent* audio = AcquireAudioComponent().Get();
+	if ( const APlayerController* pc = UGameplayStatics::GetPlayerController( GetWorld(), 0 ) )
+	{
+		FVector frontDir;
+		FVector rightDir;
+		pc->GetAudioListenerPosition( ListenerLocation_, frontDir, rightDir );
+	}
+
+	const int32 coalesceInto = FindCoalescingVoice( entry, tag, worldLocation );
+	if ( coalesceInto != INDEX_NONE )
+	{
+		FSoundVoiceState& state = VoiceStates_[coalesceInto];
+		++state.MergedCount;
+		const float boost = FMath::Min( 1.f + entry.CoalesceVolumeStep * state.MergedCount, state.MaxCoalescedVolume );
+		if ( UAudioComponent* merged = Voices_[coalesceInto] )
+		{
+			merged->SetVolumeMultiplier( state.BaseVolume * boost );
+		}
+		return;
+	}
+
+	const int32 voiceIndex = AcquireVoice( entry, tag, worldLocation );
+	if ( voiceIndex == INDEX_NONE )
+	{
+		return;
+	}
+
+	UAudioComponent* audio = Voices_[voiceIndex];
+	if ( !IsValid( audio ) || audio->GetWorld() != GetWorld() )
+	{
+		audio = CreateVoiceComponent( voiceIndex );
+	}
 	if ( !audio )
 	{
 		return;
 	}
 
 	const float categoryVolume = CategoryVolumeMultiplier( this, CategoryForTag( tag ) );
+	const float volume = FMath::RandRange( entry.VolumeRange.X, entry.VolumeRange.Y ) * categoryVolume;
+
+	FSoundVoiceState& state = VoiceStates_[voiceIndex];
+	state.Tag = tag;
+	state.Location = worldLocation;
+	state.Priority = entry.Priority;
+	state.BaseVolume = volume;
+	state.MaxCoalescedVolume = entry.MaxCoalescedVolume;
+	state.StartTime = CurrentTime();
+	state.MergedCount = 0;
+	state.bActive = true;
+	++ActiveVoicesByTag_.FindOrAdd( tag );
 
 	audio->SetWorldLocation( worldLocation );
 	audio->SetSound( entry.Sound );
-	audio->SetVolumeMultiplier( FMath::RandRange( entry.VolumeRange.X, entry.VolumeRange.Y ) * categoryVolume );
+	audio->SetVolumeMultiplier( volume );
 	audio->SetPitchMultiplier( FMath::RandRange( entry.PitchRange.X, entry.PitchRange.Y ) );
-	audio->bAllowSpatialization = true;
 
 	if ( entry.Attenuation )
 	{
@@ -256,17 +437,6 @@ void USoundEffectManager::Play3D( const FSoundEntry& entry, const FGameplayTag&
 		UE_LOG( LogTemp, Warning, TEXT( "USoundEffectManager: playing 3D sound without attenuation" ) );
 	}
 
-	TWeakObjectPtr<USoundEffectManager> weakThis = this;
-	audio->OnAudioFinishedNative.AddLambda(
-	    [weakThis]( UAudioComponent* component )
-	    {
-		    if ( weakThis.IsValid() && IsValid( component ) )
-		    {
-			    weakThis->OnSoundFinished( component );
-		    }
-	    }
-	);
-
 	audio->Play();
 	UE_LOG( LogTemp, Log, TEXT( "USoundEffectManager: playing 3D sound: %s" ), *entry.Sound->GetName() );
 }
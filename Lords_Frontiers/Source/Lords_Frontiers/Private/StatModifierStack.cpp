@@ -0,0 +1,29 @@
+#include "Lords_Frontiers/Public/StatModifierStack.h"
+
+double FStatModifierLayers::Evaluate() const
+{
+	double additive = 0.0;
+	double multiplier = 1.0;
+	bool bHasOverride = false;
+	double overrideValue = 0.0;
+
+	for ( const TPair<FStatModifierSource, FStatModifier>& pair : Modifiers )
+	{
+		const FStatModifier& modifier = pair.Value;
+		switch ( modifier.Layer )
+		{
+		case EStatModifierLayer::Additive:
+			additive += modifier.Value * modifier.Count;
+			break;
+		case EStatModifierLayer::Multiplicative:
+			multiplier *= FMath::Pow( modifier.Value, static_cast<double>( modifier.Count ) );
+			break;
+		case EStatModifierLayer::Override:
+			overrideValue = bHasOverride ? FMath::Max( overrideValue, modifier.Value ) : modifier.Value;
+			bHasOverride = true;
+			break;
+		}
+	}
+
+	return bHasOverride ? overrideValue : ( Base + additive ) * multiplier;
+}
@@ -5,6 +5,8 @@
 #include "Building/DefensiveBuilding.h"
 #include "Core/CoreManager.h"
 #include "Core/GameLoop/GameLoopManager.h"
+#include "Core/Subsystems/CameraViewSubsystem/CameraViewSubsystem.h"
+#include "Core/Subsystems/ScreenAnchorSubsystem/ScreenAnchorSubsystem.h"
 #include "Core/Debug/DebugPlayerController.h"
 #include "Resources/EconomyComponent.h"
 #include "Resources/ResourceManager.h"
@@ -477,6 +479,10 @@ void UGameHUDWidget::HandleBonusPreviewUpdated( const TArray<FBonusIconData>& Bo
 		return;
 	}
 
+	// Icons sit above the building roof (building height 80 minus 15 padding).
+	constexpr float cBonusIconHeight = 65.0f;
+	UScreenAnchorSubsystem* anchors = GetWorld() ? GetWorld()->GetSubsystem<UScreenAnchorSubsystem>() : nullptr;
+
 	TMap<FString, TArray<FBonusIconData>> grouped;
 	for ( const FBonusIconData& bonus : BonusIcons )
 	{
@@ -510,11 +516,22 @@ void UGameHUDWidget::HandleBonusPreviewUpdated( const TArray<FBonusIconData>& Bo
 			slot->SetAutoSize( true );
 			slot->SetAlignment( FVector2D( 0.5f, 1.0f ) );
 		}
+		iconWidget->SetRenderTransformPivot( FVector2D( 0.5f, 1.0f ) );
+		iconWidget->SetVisibility( ESlateVisibility::Collapsed );
 
 		ActiveBonusIcons_.Add( iconWidget );
-		ActiveBonusWorldPositions_.Add( bonuses[0].WorldLocation );
+		if ( anchors )
+		{
+			anchors->RegisterAnchor( iconWidget, bonuses[0].WorldLocation + FVector( 0.0f, 0.0f, cBonusIconHeight ) );
+		}
 	}
+
+	BonusIconZoomGeneration_ = 0;
 	UpdateBonusIconPositions();
+	if ( anchors )
+	{
+		anchors->FlushAnchors();
+	}
 }
 
 void UGameHUDWidget::NativeTick( const FGeometry& MyGeometry, float InDeltaTime )
@@ -561,74 +578,40 @@ void UGameHUDWidget::NativeTick( const FGeometry& MyGeometry, float InDeltaTime
 
 void UGameHUDWidget::UpdateBonusIconPositions()
 {
-	APlayerController* pc = GetOwningPlayer();
-
-	if ( !pc )
+	// Positions and culling are handled by UScreenAnchorSubsystem; only the zoom scale is refreshed here.
+	const FCameraViewState* viewState = UCameraViewSubsystem::FindState( this );
+	const uint64 zoomGeneration = viewState ? viewState->ZoomGeneration : 0;
+	if ( zoomGeneration != 0 && zoomGeneration == BonusIconZoomGeneration_ )
 	{
 		return;
 	}
+	BonusIconZoomGeneration_ = zoomGeneration;
 
-	const float viewportScale = UWidgetLayoutLibrary::GetViewportScale( this );
-	if ( viewportScale <= 0.0f )
-	{
-		return;
-	}
-
-	const float zoomAlpha = CameraZoomUtils::GetCameraZoomAlpha( this );
-
-	const float buildingHeight = 80.0f;
-
-	const float worldPadding = -15.0f;
-
-	for ( int32 i = 0; i < ActiveBonusIcons_.Num(); ++i )
+	const float zoomAlpha = viewState ? viewState->ZoomAlpha : CameraZoomUtils::GetCameraZoomAlpha( this );
+	for ( UBonusIconWidget* icon : ActiveBonusIcons_ )
 	{
-		if ( !IsValid( ActiveBonusIcons_[i] ) )
-		{
-			continue;
-		}
-		if ( !ActiveBonusWorldPositions_.IsValidIndex( i ) )
-		{
-			continue;
-		}
-
-		FVector topWorldPos = ActiveBonusWorldPositions_[i] + FVector( 0.0f, 0.0f, buildingHeight + worldPadding );
-
-		FVector2D screenPos;
-		if ( !pc->ProjectWorldLocationToScreen( topWorldPos, screenPos ) )
-		{
-			ActiveBonusIcons_[i]->SetVisibility( ESlateVisibility::Collapsed );
-			continue;
-		}
-
-		screenPos /= viewportScale;
-
-		ActiveBonusIcons_[i]->SetRenderTransformPivot( FVector2D( 0.5f, 1.0f ) );
-
-		UCanvasPanelSlot* slot = Cast<UCanvasPanelSlot>( ActiveBonusIcons_[i]->Slot.Get() );
-		if ( !slot )
+		if ( IsValid( icon ) )
 		{
-			continue;
+			icon->ApplyCameraScale( zoomAlpha );
 		}
-
-		slot->SetAlignment( FVector2D( 0.5f, 1.0f ) );
-		slot->SetPosition( screenPos );
-
-		ActiveBonusIcons_[i]->ApplyCameraScale( zoomAlpha );
-		ActiveBonusIcons_[i]->SetVisibility( ESlateVisibility::HitTestInvisible );
 	}
 }
 
 void UGameHUDWidget::ClearBonusIcons()
 {
+	UScreenAnchorSubsystem* anchors = GetWorld() ? GetWorld()->GetSubsystem<UScreenAnchorSubsystem>() : nullptr;
 	for ( UBonusIconWidget* icon : ActiveBonusIcons_ )
 	{
 		if ( icon )
 		{
+			if ( anchors )
+			{
+				anchors->UnregisterAnchor( icon );
+			}
 			icon->RemoveFromParent();
 		}
 	}
 	ActiveBonusIcons_.Empty();
-	ActiveBonusWorldPositions_.Empty();
 }
 
 void UGameHUDWidget::UpdateDayText()
@@ -7,9 +7,11 @@
 #include "AI/UnitAIManager.h"
 #include "Cards/StatusEffects/StatusEffectTracker.h"
 #include "Core/CoreManager.h"
+#include "Core/Subsystems/BattlefieldTeardown/BattlefieldTeardownSubsystem.h"
 #include "Core/Subsystems/HealthBarPoolSubsystem/HealthBarPoolSubsystem.h"
+#include "Core/Subsystems/UnitSignificanceSubsystem/UnitSignificanceSubsystem.h"
+#include "Core/Subsystems/VFXPoolSubsystem/VFXPoolSubsystem.h"
 #include "Lords_Frontiers/Public/Units/UnitEvents.h"
-#include "NiagaraFunctionLibrary.h"
 #include "Transform/TransformableHandleUtils.h"
 #include "UI/HealthBar/HealthBarConfigDataAsset.h"
 #include "Utilities/TraceChannelMappings.h"
@@ -26,6 +28,23 @@
 #include "Sound/AudioTags.h"
 #include "sound/SoundEffectManager.h"
 
+namespace
+{
+	struct FUnitLodRates
+	{
+		float ActorTickInterval;
+		float MeshTickInterval;
+	};
+
+	// Indexed by EUnitLodTier. Actor tick drives animation state selection (Animate).
+	// Movement is not listed: it must not depend on where the camera is looking
+	constexpr FUnitLodRates cLodRates[] = {
+	    { 0.0f, 0.0f },
+	    { 1.0f / 15.0f, 1.0f / 30.0f },
+	    { 1.0f / 5.0f, 1.0f / 10.0f },
+	};
+}
+
 AUnit::AUnit()
 {
 	PrimaryActorTick.bCanEverTick = true;
@@ -115,12 +134,18 @@ void AUnit::BeginPlay()
 
 	if ( IsValid( SkeletalMeshComponent_ ) )
 	{
+		DefaultAnimTickOption_ = SkeletalMeshComponent_->VisibilityBasedAnimTickOption;
 		SkeletalMeshComponent_->SetCollisionEnabled( ECollisionEnabled::QueryOnly );
 		SkeletalMeshComponent_->SetCollisionResponseToChannel( ECC_Visibility, ECR_Block );
 		SkeletalMeshComponent_->OnClicked.AddUniqueDynamic( this, &AUnit::OnUnitClicked );
 	}
 
 
+	if ( UUnitSignificanceSubsystem* significance = world->GetSubsystem<UUnitSignificanceSubsystem>() )
+	{
+		significance->RegisterUnit( this );
+	}
+
 	OnAudioEvent_.Broadcast( { AudioTags_.Spawn, GetActorLocation() } );
 
 	PlayAnimationIdle();
@@ -132,6 +157,17 @@ void AUnit::EndPlay( const EEndPlayReason::Type endPlayReason )
 {
 	Super::EndPlay( endPlayReason );
 
+	if ( UBattlefieldTeardownSubsystem::IsBulkTeardown( this ) )
+	{
+		// Significance is compacted once after the teardown; the audio delegate dies with the unit.
+		return;
+	}
+
+	if ( UUnitSignificanceSubsystem* significance = GetWorld()->GetSubsystem<UUnitSignificanceSubsystem>() )
+	{
+		significance->UnregisterUnit( this );
+	}
+
 	if ( const UGameInstance* gameInstance = UGameplayStatics::GetGameInstance( GetWorld() ) )
 	{
 		if ( USoundEffectManager* sfxManager = gameInstance->GetSubsystem<USoundEffectManager>() )
@@ -258,6 +294,20 @@ void AUnit::Animate()
 	}
 }
 
+void AUnit::ApplyLodTier( const EUnitLodTier tier )
+{
+	const FUnitLodRates& rates = cLodRates[static_cast<uint8>( tier )];
+
+	SetActorTickInterval( rates.ActorTickInterval );
+
+	if ( IsValid( SkeletalMeshComponent_ ) )
+	{
+		SkeletalMeshComponent_->SetComponentTickInterval( rates.MeshTickInterval );
+		SkeletalMeshComponent_->VisibilityBasedAnimTickOption =
+		    tier == EUnitLodTier::Far ? EVisibilityBasedAnimTickOption::OnlyTickPoseWhenRendered : DefaultAnimTickOption_;
+	}
+}
+
 bool AUnit::PlayAnimation( const FAnimationConfig& animation ) const
 {
 	if ( SkeletalMeshComponent_ && animation.Animation )
@@ -404,9 +454,10 @@ void AUnit::SpawnSpawnVFX()
 		return;
 	}
 
-	UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-	    GetWorld(), ResolvedSpawnVFX_, GetActorLocation(), GetActorRotation()
-	);
+	if ( UVFXPoolSubsystem* vfxPool = GetWorld()->GetSubsystem<UVFXPoolSubsystem>() )
+	{
+		vfxPool->SpawnAtLocation( ResolvedSpawnVFX_, GetActorLocation(), GetActorRotation() );
+	}
 }
 
 void AUnit::SpawnDeathVFX()
@@ -416,9 +467,10 @@ void AUnit::SpawnDeathVFX()
 		return;
 	}
 
-	UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-	    GetWorld(), ResolvedDeathVFX_, GetActorLocation(), GetActorRotation()
-	);
+	if ( UVFXPoolSubsystem* vfxPool = GetWorld()->GetSubsystem<UVFXPoolSubsystem>() )
+	{
+		vfxPool->SpawnAtLocation( ResolvedDeathVFX_, GetActorLocation(), GetActorRotation() );
+	}
 }
 
 UNiagaraSystem* AUnit::GetHitVFX() const
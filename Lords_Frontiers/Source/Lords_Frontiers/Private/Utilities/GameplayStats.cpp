@@ -0,0 +1,90 @@
+#include "Utilities/GameplayStats.h"
+
+#include <atomic>
+
+DEFINE_STAT( STAT_LF_Pathfinding );
+DEFINE_STAT( STAT_LF_TargetSearch );
+DEFINE_STAT( STAT_LF_DealDamage );
+DEFINE_STAT( STAT_LF_CardDispatch );
+DEFINE_STAT( STAT_LF_BonusRecalc );
+DEFINE_STAT( STAT_LF_SpawnEnemy );
+DEFINE_STAT( STAT_LF_StatusEffects );
+
+DEFINE_STAT( STAT_LF_ActiveUnits );
+DEFINE_STAT( STAT_LF_ActiveProjectiles );
+DEFINE_STAT( STAT_LF_PathComputations );
+DEFINE_STAT( STAT_LF_ActiveStatusEffects );
+
+UE_TRACE_CHANNEL_DEFINE( LordsFrontiersChannel );
+
+namespace
+{
+	std::atomic<uint64> GFrameCycles[FGameplayPerf::cSystemCount];
+	std::atomic<int32> GActiveStatusEffects { 0 };
+	std::atomic<int32> GPathComputations { 0 };
+}
+
+void FGameplayPerf::AddCycles( const EGameplayPerfSystem system, const uint64 cycles )
+{
+	GFrameCycles[static_cast<int32>( system )].fetch_add( cycles, std::memory_order_relaxed );
+}
+
+void FGameplayPerf::ConsumeFrame( uint64 ( &outCycles )[cSystemCount] )
+{
+	for ( int32 system = 0; system < cSystemCount; ++system )
+	{
+		outCycles[system] = GFrameCycles[system].exchange( 0, std::memory_order_relaxed );
+	}
+}
+
+void FGameplayPerf::AdjustStatusEffects( const int32 delta )
+{
+	GActiveStatusEffects.fetch_add( delta, std::memory_order_relaxed );
+	if ( delta >= 0 )
+	{
+		INC_DWORD_STAT_BY( STAT_LF_ActiveStatusEffects, delta );
+	}
+	else
+	{
+		DEC_DWORD_STAT_BY( STAT_LF_ActiveStatusEffects, -delta );
+	}
+}
+
+int32 FGameplayPerf::GetActiveStatusEffects()
+{
+	return GActiveStatusEffects.load( std::memory_order_relaxed );
+}
+
+void FGameplayPerf::CountPathComputation()
+{
+	GPathComputations.fetch_add( 1, std::memory_order_relaxed );
+	INC_DWORD_STAT( STAT_LF_PathComputations );
+}
+
+int32 FGameplayPerf::ConsumePathComputations()
+{
+	return GPathComputations.exchange( 0, std::memory_order_relaxed );
+}
+
+const TCHAR* FGameplayPerf::GetSystemName( const EGameplayPerfSystem system )
+{
+	switch ( system )
+	{
+	case EGameplayPerfSystem::Pathfinding:
+		return TEXT( "Pathfinding" );
+	case EGameplayPerfSystem::TargetSearch:
+		return TEXT( "TargetSearch" );
+	case EGameplayPerfSystem::DealDamage:
+		return TEXT( "DealDamage" );
+	case EGameplayPerfSystem::CardDispatch:
+		return TEXT( "CardDispatch" );
+	case EGameplayPerfSystem::BonusRecalc:
+		return TEXT( "BonusRecalc" );
+	case EGameplayPerfSystem::SpawnEnemy:
+		return TEXT( "SpawnEnemy" );
+	case EGameplayPerfSystem::StatusEffects:
+		return TEXT( "StatusEffects" );
+	default:
+		return TEXT( "Unknown" );
+	}
+}
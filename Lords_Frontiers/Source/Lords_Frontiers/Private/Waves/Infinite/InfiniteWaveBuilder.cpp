@@ -2,6 +2,7 @@
 
 #include "Lords_Frontiers/Public/Waves/EnemyGroupSpawnPoint.h"
 
+#include "Async/Async.h"
 #include "Curves/CurveFloat.h"
 #include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
@@ -70,8 +71,19 @@ namespace
 	}
 }
 
+void UInfiniteWaveBuilder::BeginDestroy()
+{
+	// The worker reads Config and this object, so it must finish before we go away.
+	if ( PendingLookAhead_.IsValid() )
+	{
+		PendingLookAhead_.Wait();
+	}
+	Super::BeginDestroy();
+}
+
 void UInfiniteWaveBuilder::Initialize( UInfiniteModeConfig* config, int32 sessionSeed )
 {
+	DiscardLookAhead();
 	Config = config;
 	SessionSeed = sessionSeed;
 	ResetState();
@@ -79,16 +91,16 @@ void UInfiniteWaveBuilder::Initialize( UInfiniteModeConfig* config, int32 sessio
 
 void UInfiniteWaveBuilder::ResetState()
 {
-	CarryOverBudget = 0;
-	LastApexWave = -10000;
-	LastWaveSeenPreset_.Empty();
-	LastWaveSeenSector_.Empty();
+	DiscardLookAhead();
+	State_ = FInfiniteBuilderState();
+	SectorTable_ = FInfiniteSectorTable();
+	++StateGeneration_;
 	LastThemeId = NAME_None;
 	LastBudget = 0;
 	LastScalingBuff = FEnemyBuff();
 }
 
-int32 UInfiniteWaveBuilder::ComputeBudget( int32 waveIndex ) const
+int32 UInfiniteWaveBuilder::ComputeBudget( int32 waveIndex, const FInfiniteBuilderState& state ) const
 {
 	if ( !Config )
 	{
@@ -109,7 +121,7 @@ int32 UInfiniteWaveBuilder::ComputeBudget( int32 waveIndex ) const
 		budget *= FMath::Max( 1.0f, Config->SpikeBudgetMultiplier );
 	}
 
-	budget += CarryOverBudget;
+	budget += state.CarryOverBudget;
 
 	return FMath::Max( 0, FMath::RoundToInt( budget ) );
 }
@@ -254,7 +266,7 @@ float UInfiniteWaveBuilder::RecencyMultiplier( int32 lastSeenWave, int32 current
 
 float UInfiniteWaveBuilder::PresetWeight(
     const UEnemyPresetData* preset, const FInfiniteTheme& theme, int32 waveIndex, int32 remainingBudget,
-    const TMap<FName, int32>& usedThisWave, bool bCoreOnly
+    const TMap<FName, int32>& usedThisWave, bool bCoreOnly, const FInfiniteBuilderState& state
 ) const
 {
 	if ( !preset || !preset->EnemyClass )
@@ -300,7 +312,7 @@ float UInfiniteWaveBuilder::PresetWeight(
 		const float antiRepeat = FMath::Pow( 0.7f, static_cast<float>( used ) );
 		w *= antiRepeat;
 
-		if ( const int32* lastSeen = LastWaveSeenPreset_.Find( preset->GetFName() ) )
+		if ( const int32* lastSeen = state.LastWaveSeenPreset.Find( preset->GetFName() ) )
 		{
 			w *= RecencyMultiplier( *lastSeen, waveIndex );
 		}
@@ -311,7 +323,7 @@ float UInfiniteWaveBuilder::PresetWeight(
 
 UEnemyPresetData* UInfiniteWaveBuilder::PickPreset(
     FRandomStream& rng, const FInfiniteTheme& theme, int32 waveIndex, int32 remainingBudget,
-    const TMap<FName, int32>& usedThisWave, bool bCoreOnly, bool bOffThemeOnly
+    const TMap<FName, int32>& usedThisWave, bool bCoreOnly, bool bOffThemeOnly, const FInfiniteBuilderState& state
 ) const
 {
 	if ( !Config )
@@ -326,7 +338,7 @@ UEnemyPresetData* UInfiniteWaveBuilder::PickPreset(
 	for ( const TObjectPtr<UEnemyPresetData>& presetPtr : Config->Presets )
 	{
 		UEnemyPresetData* preset = presetPtr.Get();
-		float w = PresetWeight( preset, theme, waveIndex, remainingBudget, usedThisWave, bCoreOnly );
+		float w = PresetWeight( preset, theme, waveIndex, remainingBudget, usedThisWave, bCoreOnly, state );
 
 		if ( bOffThemeOnly && w > 0.f )
 		{
@@ -366,42 +378,51 @@ UEnemyPresetData* UInfiniteWaveBuilder::PickPreset(
 	return Config->Presets.Last().Get();
 }
 
-TArray<FName> UInfiniteWaveBuilder::CollectAllSectors( UObject* worldContextObject ) const
+void UInfiniteWaveBuilder::EnsureSectorTable( UObject* worldContextObject )
 {
-	TArray<FName> sectors;
-	if ( !worldContextObject )
+	if ( SectorTable_.bIsBuilt )
 	{
-		return sectors;
+		return;
 	}
 
-	UWorld* world = worldContextObject->GetWorld();
+	UWorld* world = worldContextObject ? worldContextObject->GetWorld() : nullptr;
 	if ( !world )
 	{
-		return sectors;
+		return;
 	}
 
 	TArray<AActor*> actors;
 	UGameplayStatics::GetAllActorsOfClass( world, AEnemyGroupSpawnPoint::StaticClass(), actors );
 
-	TSet<FName> seen;
+	TSet<FName> seenSectors;
 	for ( AActor* a : actors )
 	{
 		const AEnemyGroupSpawnPoint* sp = Cast<AEnemyGroupSpawnPoint>( a );
-		if ( sp && !sp->Sector.IsNone() )
+		if ( !sp || sp->SpawnPointId.IsNone() )
 		{
-			if ( !seen.Contains( sp->Sector ) )
-			{
-				seen.Add( sp->Sector );
-				sectors.Add( sp->Sector );
-			}
+			continue;
+		}
+		SectorTable_.FlyerFreePortals.Add( sp->SpawnPointId );
+
+		const FName sectorName = sp->Sector.IsNone() ? FName( TEXT( "Default" ) ) : sp->Sector;
+		SectorTable_.SectorToPortalIds.FindOrAdd( sectorName ).Add( sp->SpawnPointId );
+		if ( sp->bAllowBoss )
+		{
+			SectorTable_.SectorToBossPortalIds.FindOrAdd( sectorName ).Add( sp->SpawnPointId );
+		}
+		if ( !seenSectors.Contains( sectorName ) )
+		{
+			seenSectors.Add( sectorName );
+			SectorTable_.AllSectors.Add( sectorName );
 		}
 	}
 
-	return sectors;
+	SectorTable_.bIsBuilt = true;
 }
 
 TArray<FName> UInfiniteWaveBuilder::PickActiveSectors(
-    FRandomStream& rng, const FInfiniteTheme& theme, int32 waveIndex, const TArray<FName>& allSectors
+    FRandomStream& rng, const FInfiniteTheme& theme, int32 waveIndex, const TArray<FName>& allSectors,
+    const FInfiniteBuilderState& state
 ) const
 {
 	TArray<FName> out;
@@ -422,9 +443,9 @@ TArray<FName> UInfiniteWaveBuilder::PickActiveSectors(
 	for ( const FName& s : pool )
 	{
 		float w = 1.0f;
-		if ( LastWaveSeenSector_.Contains( s ) )
+		if ( const int32* lastSeen = state.LastWaveSeenSector.Find( s ) )
 		{
-			w *= RecencyMultiplier( LastWaveSeenSector_.FindRef( s ), waveIndex );
+			w *= RecencyMultiplier( *lastSeen, waveIndex );
 		}
 		weights.Add( w );
 		total += w;
@@ -527,7 +548,7 @@ TArray<FName> UInfiniteWaveBuilder::PickActiveSectors(
 void UInfiniteWaveBuilder::AssignPortalsToPurchases(
     FRandomStream& rng, TArray<FInfinitePurchase>& purchases, const TArray<FName>& activeSectors,
     const TMap<FName, TArray<FName>>& sectorToPortalIds, const TArray<FName>& flyerFreePortals
-)
+) const
 {
 	if ( activeSectors.Num() == 0 )
 	{
@@ -619,14 +640,16 @@ void UInfiniteWaveBuilder::AssignPortalsToPurchases(
 	}
 }
 
-UWaveData* UInfiniteWaveBuilder::AssembleWaveData(
-    const TArray<FInfinitePurchase>& purchases, const FInfiniteTheme& theme, const FEnemyBuff& scalingBuff, bool bSpike
-) const
+UWaveData* UInfiniteWaveBuilder::AssembleWaveData( const FInfiniteWavePlan& plan ) const
 {
 	UWaveData* waveData = NewObject<UWaveData>( const_cast<UInfiniteWaveBuilder*>( this ), NAME_None, RF_Transient );
 
-	FEnemyBuff baseBuff = CombineBuffsMultiplicative( theme.ThemeBuff, scalingBuff );
-	if ( bSpike && Config )
+	static const FInfiniteTheme fallbackTheme;
+	const FInfiniteTheme& theme =
+	    ( Config && Config->Themes.IsValidIndex( plan.ThemeIndex ) ) ? Config->Themes[plan.ThemeIndex] : fallbackTheme;
+
+	FEnemyBuff baseBuff = CombineBuffsMultiplicative( theme.ThemeBuff, plan.ScalingBuff );
+	if ( plan.bSpike && Config )
 	{
 		baseBuff = CombineBuffsMultiplicative( baseBuff, Config->SpikeExtraBuff );
 	}
@@ -635,7 +658,7 @@ UWaveData* UInfiniteWaveBuilder::AssembleWaveData(
 		baseBuff = ClampBuffToCap( baseBuff, Config->Scaling.CapBuff );
 	}
 
-	for ( const FInfinitePurchase& p : purchases )
+	for ( const FInfinitePurchase& p : plan.Purchases )
 	{
 		if ( !p.Preset || !p.Preset->EnemyClass || p.Times <= 0 )
 		{
@@ -661,42 +684,44 @@ UWaveData* UInfiniteWaveBuilder::AssembleWaveData(
 	return waveData;
 }
 
-void UInfiniteWaveBuilder::RememberWave( int32 waveIndex, const TArray<FInfinitePurchase>& purchases, bool bApexSeen )
+void UInfiniteWaveBuilder::RememberWave(
+    FInfiniteBuilderState& state, int32 waveIndex, const TArray<FInfinitePurchase>& purchases, bool bApexSeen
+)
 {
 	for ( const FInfinitePurchase& p : purchases )
 	{
 		if ( p.Preset )
 		{
-			LastWaveSeenPreset_.FindOrAdd( p.Preset->GetFName() ) = waveIndex;
+			state.LastWaveSeenPreset.FindOrAdd( p.Preset->GetFName() ) = waveIndex;
 		}
 		if ( !p.ChosenSector.IsNone() )
 		{
-			LastWaveSeenSector_.FindOrAdd( p.ChosenSector ) = waveIndex;
+			state.LastWaveSeenSector.FindOrAdd( p.ChosenSector ) = waveIndex;
 		}
 	}
 	if ( bApexSeen )
 	{
-		LastApexWave = waveIndex;
+		state.LastApexWave = waveIndex;
 	}
 }
 
-UWaveData* UInfiniteWaveBuilder::BuildWave( int32 waveIndex, UObject* worldContextObject )
+FInfiniteWavePlan UInfiniteWaveBuilder::PlanWave(
+    int32 waveIndex, const FInfiniteBuilderState& state, const FInfiniteSectorTable& sectors
+) const
 {
-	if ( !Config || Config->Presets.Num() == 0 )
-	{
-		return nullptr;
-	}
+	FInfiniteWavePlan plan;
+	plan.WaveIndex = waveIndex;
+	plan.StateAfter = state;
 
 	const int32 perWaveSeed = SessionSeed ^ static_cast<int32>( ( static_cast<uint32>( waveIndex ) + 1u ) * 0x9E3779B9u );
 	FRandomStream rng( perWaveSeed );
 
 	const bool bSpike = IsSpikeWave( waveIndex );
-	const int32 budgetStart = ComputeBudget( waveIndex );
+	const int32 budgetStart = ComputeBudget( waveIndex, state );
 	int32 budget = budgetStart;
-	LastBudget = budget;
-
-	const FEnemyBuff scalingBuff = ComputeScalingBuff( waveIndex );
-	LastScalingBuff = scalingBuff;
+	plan.bSpike = bSpike;
+	plan.Budget = budget;
+	plan.ScalingBuff = ComputeScalingBuff( waveIndex );
 
 	const FInfiniteTheme* themePtr = RollTheme( rng, waveIndex, bSpike );
 	if ( !themePtr )
@@ -704,10 +729,14 @@ UWaveData* UInfiniteWaveBuilder::BuildWave( int32 waveIndex, UObject* worldConte
 		static const FInfiniteTheme fallbackTheme;
 		themePtr = &fallbackTheme;
 	}
+	else
+	{
+		plan.ThemeIndex = static_cast<int32>( themePtr - Config->Themes.GetData() );
+	}
 	const FInfiniteTheme& theme = *themePtr;
-	LastThemeId = theme.ThemeId;
+	plan.ThemeId = theme.ThemeId;
 
-	TArray<FInfinitePurchase> purchases;
+	TArray<FInfinitePurchase>& purchases = plan.Purchases;
 	TMap<FName, int32> usedThisWave;
 	int32 totalEnemies = 0;
 	int32 ecoHarassers = 0;
@@ -724,7 +753,7 @@ UWaveData* UInfiniteWaveBuilder::BuildWave( int32 waveIndex, UObject* worldConte
 		}
 		if ( preset->HasTag( EEnemyTag::Apex ) )
 		{
-			if ( waveIndex - LastApexWave < Config->ApexCooldownWaves )
+			if ( waveIndex - state.LastApexWave < Config->ApexCooldownWaves )
 			{
 				return false;
 			}
@@ -756,7 +785,7 @@ UWaveData* UInfiniteWaveBuilder::BuildWave( int32 waveIndex, UObject* worldConte
 	};
 
 	int32 coreBudget = FMath::RoundToInt( budgetStart * FMath::Clamp( theme.CoreBudgetFraction, 0.0f, 1.0f ) );
-	UEnemyPresetData* coreAnchor = PickPreset( rng, theme, waveIndex, coreBudget, usedThisWave, true, false );
+	UEnemyPresetData* coreAnchor = PickPreset( rng, theme, waveIndex, coreBudget, usedThisWave, true, false, state );
 	if ( coreAnchor )
 	{
 		while ( coreAnchor && coreAnchor->Cost <= coreBudget && coreAnchor->Cost <= budget )
@@ -776,7 +805,7 @@ UWaveData* UInfiniteWaveBuilder::BuildWave( int32 waveIndex, UObject* worldConte
 
 	for ( int32 safety = 0; safety < 64; ++safety )
 	{
-		UEnemyPresetData* next = PickPreset( rng, theme, waveIndex, budget, usedThisWave, false, false );
+		UEnemyPresetData* next = PickPreset( rng, theme, waveIndex, budget, usedThisWave, false, false, state );
 		if ( !next )
 		{
 			break;
@@ -789,7 +818,7 @@ UWaveData* UInfiniteWaveBuilder::BuildWave( int32 waveIndex, UObject* worldConte
 
 	if ( rng.GetFraction() < theme.SpiceChance )
 	{
-		UEnemyPresetData* spice = PickPreset( rng, theme, waveIndex, budget, usedThisWave, false, true );
+		UEnemyPresetData* spice = PickPreset( rng, theme, waveIndex, budget, usedThisWave, false, true, state );
 		if ( spice )
 		{
 			buyPreset( spice );
@@ -838,47 +867,13 @@ UWaveData* UInfiniteWaveBuilder::BuildWave( int32 waveIndex, UObject* worldConte
 		}
 	}
 
-	CarryOverBudget = FMath::Max( 0, budget );
-
-	UWorld* world = worldContextObject ? worldContextObject->GetWorld() : nullptr;
+	plan.StateAfter.CarryOverBudget = FMath::Max( 0, budget );
 
-	TArray<FName> allSectors;
-	TMap<FName, TArray<FName>> sectorToPortalIds;
-	TMap<FName, TArray<FName>> sectorToBossPortalIds;
-	TArray<FName> flyerFreePortals;
+	TArray<FName> activeSectors = PickActiveSectors( rng, theme, waveIndex, sectors.AllSectors, state );
 
-	if ( world )
-	{
-		TArray<AActor*> actors;
-		UGameplayStatics::GetAllActorsOfClass( world, AEnemyGroupSpawnPoint::StaticClass(), actors );
-
-		TSet<FName> seenSectors;
-		for ( AActor* a : actors )
-		{
-			const AEnemyGroupSpawnPoint* sp = Cast<AEnemyGroupSpawnPoint>( a );
-			if ( !sp || sp->SpawnPointId.IsNone() )
-			{
-				continue;
-			}
-			flyerFreePortals.Add( sp->SpawnPointId );
-
-			const FName sectorName = sp->Sector.IsNone() ? FName( TEXT( "Default" ) ) : sp->Sector;
-			sectorToPortalIds.FindOrAdd( sectorName ).Add( sp->SpawnPointId );
-			if ( sp->bAllowBoss )
-			{
-				sectorToBossPortalIds.FindOrAdd( sectorName ).Add( sp->SpawnPointId );
-			}
-			if ( !seenSectors.Contains( sectorName ) )
-			{
-				seenSectors.Add( sectorName );
-				allSectors.Add( sectorName );
-			}
-		}
-	}
-
-	TArray<FName> activeSectors = PickActiveSectors( rng, theme, waveIndex, allSectors );
-
-	AssignPortalsToPurchases( rng, purchases, activeSectors, sectorToPortalIds, flyerFreePortals );
+	AssignPortalsToPurchases(
+	    rng, purchases, activeSectors, sectors.SectorToPortalIds, sectors.FlyerFreePortals
+	);
 
 	for ( FInfinitePurchase& p : purchases )
 	{
@@ -888,7 +883,7 @@ UWaveData* UInfiniteWaveBuilder::BuildWave( int32 waveIndex, UObject* worldConte
 		}
 		if ( p.Preset->HasTag( EEnemyTag::Boss ) || p.Preset->HasTag( EEnemyTag::Apex ) )
 		{
-			const TArray<FName>* bossPortals = sectorToBossPortalIds.Find( p.ChosenSector );
+			const TArray<FName>* bossPortals = sectors.SectorToBossPortalIds.Find( p.ChosenSector );
 			if ( bossPortals && bossPortals->Num() > 0 )
 			{
 				p.ChosenPortalId = ( *bossPortals )[rng.RandRange( 0, bossPortals->Num() - 1 )];
@@ -905,7 +900,204 @@ UWaveData* UInfiniteWaveBuilder::BuildWave( int32 waveIndex, UObject* worldConte
 			break;
 		}
 	}
-	RememberWave( waveIndex, purchases, bApexSeen );
+	RememberWave( plan.StateAfter, waveIndex, purchases, bApexSeen );
 
-	return AssembleWaveData( purchases, theme, scalingBuff, bSpike );
+	return plan;
+}
+
+void UInfiniteWaveBuilder::CommitPlan( const FInfiniteWavePlan& plan )
+{
+	State_ = plan.StateAfter;
+	LastThemeId = plan.ThemeId;
+	LastBudget = plan.Budget;
+	LastScalingBuff = plan.ScalingBuff;
+}
+
+UWaveData* UInfiniteWaveBuilder::BuildWave( int32 waveIndex, UObject* worldContextObject )
+{
+	if ( !Config || Config->Presets.Num() == 0 )
+	{
+		return nullptr;
+	}
+
+	CollectLookAhead( true );
+
+	if ( LookAheadGeneration_ == StateGeneration_ && LookAheadPlans_.Num() > 0
+	     && LookAheadPlans_[0].WaveIndex == waveIndex )
+	{
+		// Plans are chained, so the remaining ones stay valid after consuming the first.
+		const FInfiniteWavePlan plan = MoveTemp( LookAheadPlans_[0] );
+		LookAheadPlans_.RemoveAt( 0 );
+		CommitPlan( plan );
+		return AssembleWaveData( plan );
+	}
+
+	DiscardLookAhead();
+	EnsureSectorTable( worldContextObject );
+
+	const FInfiniteWavePlan plan = PlanWave( waveIndex, State_, SectorTable_ );
+	CommitPlan( plan );
+	++StateGeneration_;
+
+	return AssembleWaveData( plan );
+}
+
+void UInfiniteWaveBuilder::SetSectorTable( const FInfiniteSectorTable& table )
+{
+	DiscardLookAhead();
+	SectorTable_ = table;
+	SectorTable_.bIsBuilt = true;
+	++StateGeneration_;
+}
+
+FInfiniteWavePlan UInfiniteWaveBuilder::SimulateWave( int32 waveIndex )
+{
+	if ( !Config || Config->Presets.Num() == 0 )
+	{
+		return FInfiniteWavePlan();
+	}
+
+	FInfiniteWavePlan plan = PlanWave( waveIndex, State_, SectorTable_ );
+	CommitPlan( plan );
+	++StateGeneration_;
+	return plan;
+}
+
+void UInfiniteWaveBuilder::PrecomputeAhead( int32 firstWaveIndex, int32 count, UObject* worldContextObject )
+{
+	if ( !Config || Config->Presets.Num() == 0 || count <= 0 )
+	{
+		return;
+	}
+
+	CollectLookAhead( false );
+
+	const bool bPendingValid = PendingLookAhead_.IsValid() && PendingGeneration_ == StateGeneration_;
+	const bool bPlansValid = LookAheadGeneration_ == StateGeneration_ && LookAheadPlans_.Num() > 0
+	                         && LookAheadPlans_[0].WaveIndex == firstWaveIndex;
+	if ( bPendingValid || ( bPlansValid && LookAheadPlans_.Num() >= count ) )
+	{
+		return;
+	}
+
+	DiscardLookAhead();
+	EnsureSectorTable( worldContextObject );
+
+	PendingGeneration_ = StateGeneration_;
+	PendingLookAhead_ = Async(
+	    EAsyncExecution::ThreadPool,
+	    [this, state = State_, sectors = SectorTable_, firstWaveIndex, count]()
+	    {
+		    TArray<FInfiniteWavePlan> plans;
+		    plans.Reserve( count );
+
+		    FInfiniteBuilderState running = state;
+		    for ( int32 i = 0; i < count; ++i )
+		    {
+			    FInfiniteWavePlan& plan = plans.Add_GetRef( PlanWave( firstWaveIndex + i, running, sectors ) );
+			    running = plan.StateAfter;
+		    }
+		    return plans;
+	    },
+	    [weakThis = TWeakObjectPtr<UInfiniteWaveBuilder>( this )]()
+	    {
+		    AsyncTask(
+		        ENamedThreads::GameThread,
+		        [weakThis]()
+		        {
+			        if ( UInfiniteWaveBuilder* builder = weakThis.Get() )
+			        {
+				        builder->CollectLookAhead( false );
+			        }
+		        }
+		    );
+	    }
+	);
+}
+
+void UInfiniteWaveBuilder::CollectLookAhead( bool bWait )
+{
+	if ( !PendingLookAhead_.IsValid() )
+	{
+		return;
+	}
+	if ( !bWait && !PendingLookAhead_.IsReady() )
+	{
+		return;
+	}
+
+	TArray<FInfiniteWavePlan> plans = PendingLookAhead_.Consume();
+	const int32 generation = PendingGeneration_;
+	PendingGeneration_ = INDEX_NONE;
+
+	if ( generation != StateGeneration_ )
+	{
+		return;
+	}
+
+	LookAheadPlans_ = MoveTemp( plans );
+	LookAheadGeneration_ = generation;
+	OnLookAheadReady.Broadcast();
+}
+
+void UInfiniteWaveBuilder::DiscardLookAhead()
+{
+	if ( PendingLookAhead_.IsValid() )
+	{
+		PendingLookAhead_.Wait();
+		PendingLookAhead_.Reset();
+	}
+	PendingGeneration_ = INDEX_NONE;
+	LookAheadPlans_.Reset();
+	LookAheadGeneration_ = INDEX_NONE;
+}
+
+const FInfiniteWavePlan* UInfiniteWaveBuilder::FindPlan( int32 waveIndex ) const
+{
+	if ( LookAheadGeneration_ != StateGeneration_ )
+	{
+		return nullptr;
+	}
+	return LookAheadPlans_.FindByPredicate( [waveIndex]( const FInfiniteWavePlan& plan )
+	                                        { return plan.WaveIndex == waveIndex; } );
+}
+
+bool UInfiniteWaveBuilder::TryGetPlannedComposition(
+    int32 waveIndex, TMap<TSubclassOf<AUnit>, int32>& outComposition
+) const
+{
+	const FInfiniteWavePlan* plan = FindPlan( waveIndex );
+	if ( !plan )
+	{
+		return false;
+	}
+
+	outComposition.Reset();
+	for ( const FInfinitePurchase& p : plan->Purchases )
+	{
+		if ( !p.Preset || !p.Preset->EnemyClass || p.Times <= 0 || p.ChosenPortalId.IsNone() )
+		{
+			continue;
+		}
+		outComposition.FindOrAdd( p.Preset->EnemyClass ) += p.Preset->Count * p.Times;
+	}
+	return true;
+}
+
+void UInfiniteWaveBuilder::GetPlannedEnemyClasses( TSet<TSubclassOf<AUnit>>& outClasses ) const
+{
+	if ( LookAheadGeneration_ != StateGeneration_ )
+	{
+		return;
+	}
+	for ( const FInfiniteWavePlan& plan : LookAheadPlans_ )
+	{
+		for ( const FInfinitePurchase& p : plan.Purchases )
+		{
+			if ( p.Preset && p.Preset->EnemyClass )
+			{
+				outClasses.Add( p.Preset->EnemyClass );
+			}
+		}
+	}
 }
@@ -2,8 +2,13 @@
 
 #include "AI/Path/Path.h"
 #include "Cards/Visuals/CardVisualSubsystem.h"
+#include "Components/Attack/AttackRangedComponent.h"
 #include "Core/CoreManager.h"
 #include "Core/GameLoop/GameLoopManager.h"
+#include "Core/Subsystems/HealthBarPoolSubsystem/HealthBarPoolSubsystem.h"
+#include "Core/Subsystems/ProjectilePoolSubsystem/ProjectilePoolSubsystem.h"
+#include "Core/Subsystems/SessionRandom/SessionRandomSubsystem.h"
+#include "Utilities/GameplayStats.h"
 #include "Lords_Frontiers/Public/Waves/Infinite/InfiniteModeConfig.h"
 #include "Lords_Frontiers/Public/Waves/Infinite/InfiniteWaveBuilder.h"
 #include "Lords_Frontiers/Public/Waves/WaveData.h"
@@ -46,6 +51,7 @@ void AWaveManager::BeginPlay()
 	}
 
 	EnsureInfiniteBuilder();
+	PreWarmPoolsForWaveConfig();
 
 	if ( bAutoStartOnBeginPlay )
 	{
@@ -79,8 +85,12 @@ void AWaveManager::EnsureInfiniteBuilder()
 	if ( !InfiniteBuilder_ )
 	{
 		InfiniteBuilder_ = NewObject<UInfiniteWaveBuilder>( this );
+		LookAheadReadyHandle_ =
+		    InfiniteBuilder_->OnLookAheadReady.AddUObject( this, &AWaveManager::HandleInfiniteLookAheadReady );
 	}
-	const int32 seed = ( InfiniteSessionSeed != 0 ) ? InfiniteSessionSeed : FMath::Rand();
+	const int32 seed = ( InfiniteSessionSeed != 0 )
+	                       ? InfiniteSessionSeed
+	                       : USessionRandomSubsystem::Stream( this, RandomStreams::Waves ).RandHelper( MAX_int32 );
 	InfiniteBuilder_->Initialize( InfiniteConfig, seed );
 }
 
@@ -120,6 +130,103 @@ UWaveData* AWaveManager::BuildAndCacheInfiniteWave( int32 waveIndex )
 	return generated;
 }
 
+void AWaveManager::PrecomputeInfiniteWaves( int32 nextWaveIndex )
+{
+	if ( !InfiniteConfig || !InfiniteBuilder_ || InfiniteConfig->LookAheadWaves <= 0 )
+	{
+		return;
+	}
+
+	// Builder state only advances on infinite waves, so planning starts at the first one not built yet.
+	int32 firstIndex = FMath::Max( nextWaveIndex, InfiniteConfig->StartWaveIndex );
+	while ( SelectedWavePresets_.Contains( firstIndex ) )
+	{
+		++firstIndex;
+	}
+
+	if ( firstIndex - nextWaveIndex >= InfiniteConfig->LookAheadWaves )
+	{
+		return;
+	}
+
+	InfiniteBuilder_->PrecomputeAhead( firstIndex, InfiniteConfig->LookAheadWaves, this );
+}
+
+void AWaveManager::HandleInfiniteLookAheadReady()
+{
+	if ( !InfiniteBuilder_ || !InfiniteConfig )
+	{
+		return;
+	}
+
+	TSet<TSubclassOf<AUnit>> enemyClasses;
+	InfiniteBuilder_->GetPlannedEnemyClasses( enemyClasses );
+	PreWarmPoolsForEnemyClasses( enemyClasses, InfiniteConfig->ProjectileWarmupPerEnemyClass );
+
+	OnWaveEnemiesUpdated.Broadcast();
+}
+
+void AWaveManager::PreWarmPoolsForWaveConfig() const
+{
+	if ( !WaveConfig_ )
+	{
+		return;
+	}
+
+	// Presets are picked at random per wave, so every candidate counts
+	TSet<TSubclassOf<AUnit>> enemyClasses;
+	for ( const FWavePresetSlot& slot : WaveConfig_->Waves )
+	{
+		for ( const FWeightedWavePreset& entry : slot.Presets )
+		{
+			if ( entry.Preset )
+			{
+				for ( const TPair<TSubclassOf<AUnit>, FEnemySpawnSettings>& spawn : entry.Preset->EnemySpawnMap )
+				{
+					enemyClasses.Add( spawn.Key );
+				}
+			}
+		}
+	}
+
+	PreWarmPoolsForEnemyClasses( enemyClasses, ProjectileWarmupPerEnemyClass );
+}
+
+void AWaveManager::PreWarmPoolsForEnemyClasses(
+    const TSet<TSubclassOf<AUnit>>& enemyClasses, const int32 projectilesPerClass
+) const
+{
+	UWorld* world = GetWorld();
+	if ( !world )
+	{
+		return;
+	}
+
+	UProjectilePoolSubsystem* pool = world->GetSubsystem<UProjectilePoolSubsystem>();
+	UHealthBarPoolSubsystem* healthBars = world->GetSubsystem<UHealthBarPoolSubsystem>();
+
+	for ( const TSubclassOf<AUnit>& enemyClass : enemyClasses )
+	{
+		AUnit* defaultUnit = enemyClass ? enemyClass->GetDefaultObject<AUnit>() : nullptr;
+		if ( !defaultUnit )
+		{
+			continue;
+		}
+
+		if ( healthBars )
+		{
+			healthBars->PreWarmFor( defaultUnit, defaultUnit->HealthBarConfig() );
+		}
+
+		const UAttackRangedComponent* attack = defaultUnit->FindComponentByClass<UAttackRangedComponent>();
+		if ( pool && projectilesPerClass > 0 && attack && attack->ProjectileClass() )
+		{
+			const int32 missing = projectilesPerClass - pool->GetPooledCount( attack->ProjectileClass() );
+			pool->PreWarmPool( attack->ProjectileClass(), missing );
+		}
+	}
+}
+
 int32 AWaveManager::ClampWaveIndex( int32 waveIndex ) const
 {
 	const int32 finiteCount = GetWavesCount();
@@ -304,6 +411,8 @@ void AWaveManager::ScheduleWaveSpawns( const UWaveData* waveData, int32 waveInde
 
 void AWaveManager::SpawnEnemy( int32 waveIndex, UClass* enemyClass, FName spawnPointId, int32 enemyIndex )
 {
+	LF_SCOPE_CYCLE_COUNTER( SpawnEnemy );
+
 	if ( !GetWorld() || !enemyClass )
 	{
 		return;
@@ -463,7 +572,10 @@ void AWaveManager::OnWaveEndTimerElapsed( int32 waveIndex )
 		{
 			UE_LOG( LogTemp, Log, TEXT( "WaveManager: All waves completed." ) );
 		}
+		return;
 	}
+
+	PrecomputeInfiniteWaves( waveIndex + 1 );
 }
 
 void AWaveManager::AdvanceToNextWave()
@@ -512,6 +624,7 @@ void AWaveManager::CancelCurrentWave()
 	bIsWaveActive_ = false;
 
 	RemainingEnemiesPerClass_.Empty();
+	OnWaveEnemiesUpdated.Broadcast();
 
 	if ( UCardVisualSubsystem* visuals = UCardVisualSubsystem::Get( this ) )
 	{
@@ -650,17 +763,21 @@ void AWaveManager::BroadcastAllWavesCompleted()
 
 int32 AWaveManager::DestroyAllEnemies()
 {
+	// Unbind first so destroying N units does not run HandleSpawnedDestroyed (and a HUD refresh) N times;
+	// the caller resets the counters and broadcasts once.
+	TArray<TWeakObjectPtr<AUnit>> units = MoveTemp( SpawnedUnits_ );
+	SpawnedUnits_.Reset();
+
 	int32 destroyed = 0;
-	for ( int32 i = SpawnedUnits_.Num() - 1; i >= 0; --i )
+	for ( const TWeakObjectPtr<AUnit>& weakUnit : units )
 	{
-		AUnit* unit = SpawnedUnits_[i].Get();
-		if ( unit )
+		if ( AUnit* unit = weakUnit.Get() )
 		{
+			unit->OnDestroyed.RemoveDynamic( this, &AWaveManager::HandleSpawnedDestroyed );
 			unit->Destroy();
 			++destroyed;
 		}
 	}
-	SpawnedUnits_.Empty();
 
 	return destroyed;
 }
@@ -740,6 +857,13 @@ TMap<TSubclassOf<AUnit>, int32> AWaveManager::GetNextWaveComposition( int32 targ
 		return result;
 	}
 
+	// Peek at a precomputed plan instead of committing the wave early from UI.
+	if ( bIsInfinite && InfiniteBuilder_ && !SelectedWavePresets_.Contains( targetWaveIndex )
+	     && InfiniteBuilder_->TryGetPlannedComposition( targetWaveIndex, result ) )
+	{
+		return result;
+	}
+
 	const UWaveData* waveData = GetSelectedWaveData( targetWaveIndex );
 	if ( !waveData )
 	{
@@ -897,7 +1021,7 @@ const UWaveData* AWaveManager::PickWeightedWavePreset( const FWavePresetSlot& sl
 		return nullptr;
 	}
 
-	const float roll = FMath::FRandRange( 0.f, totalWeight );
+	const float roll = USessionRandomSubsystem::Stream( this, RandomStreams::Waves ).FRandRange( 0.f, totalWeight );
 	float accumulated = 0.f;
 
 	for ( const FWeightedWavePreset& entry : slot.Presets )
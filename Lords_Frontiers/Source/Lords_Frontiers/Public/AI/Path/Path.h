@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "AI/Path/PathPointsManager.h"
 #include "DStarLite.h"
 
 #include "CoreMinimal.h"
@@ -12,6 +13,7 @@
 class ASplinePointConnector;
 class AGridManager;
 class AUnit;
+class AUnitAIManager;
 
 /** (Gregory-hub)
  * Class that represents a path that is traveled by unit */
@@ -38,12 +40,24 @@ public:
 
 	const TArray<FIntPoint>& GetPoints() const;
 
+	// True if the cell (runtime grid index) is one of the points not yet removed from the path
+	bool ContainsCellIndex( const int32 cellIndex ) const
+	{
+		if ( !InternedCells_.IsValid() || cellIndex == INDEX_NONE )
+		{
+			return false;
+		}
+		const int32* position = InternedCells_->PositionByCellIndex.Find( cellIndex );
+		return position && *position >= ConsumedPoints_;
+	}
+
 	// Delay time is configured in AUnitAIManager
 	void RemovePoint( int index );
 
-	ASplinePointConnector* GetSpline() const
+	// Interned sequence this path is drawn with in the shared path renderer; null if not drawn
+	const FInternedPathCells* GetRenderedCells() const
 	{
-		return Spline_;
+		return RenderedCells_.Get();
 	}
 
 private:
@@ -53,8 +67,19 @@ private:
 	UPROPERTY()
 	TArray<FIntPoint> PathPoints_;
 
-	UPROPERTY()
-	TObjectPtr<ASplinePointConnector> Spline_;
+	const AUnitAIManager* FindUnitAIManager() const;
+
+	ASplinePointConnector* FindPathRenderer() const;
+
+	void InternPoints();
+
+	// Shared lookup over the calculated sequence; points removed from the front are skipped via ConsumedPoints_
+	TSharedPtr<const FInternedPathCells> InternedCells_;
+
+	int32 ConsumedPoints_ = 0;
+
+	// Kept separately from InternedCells_, which RemovePoint may re-intern while the drawn section stays the same
+	TSharedPtr<const FInternedPathCells> RenderedCells_;
 
 	FTimerHandle RebuildSplineTimerHandle_;
 
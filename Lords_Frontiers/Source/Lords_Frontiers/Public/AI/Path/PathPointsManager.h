@@ -31,6 +31,15 @@ private:
 	TMap<TSubclassOf<AUnit>, TObjectPtr<APathTargetPoint>> Points_;
 };
 
+// Immutable cell sequence shared by all paths that step on the same cells
+struct FInternedPathCells
+{
+	TArray<FIntPoint> Cells;
+
+	// Runtime grid cell index -> position in Cells
+	TMap<int32, int32> PositionByCellIndex;
+};
+
 /** (Gregory-hub)
  * Class for storing and retrieving path points that exist in the world and can be followed */
 UCLASS()
@@ -69,6 +78,9 @@ public:
 	// Path destination is on path as well
 	bool ActorIsOnPath( const AActor* enemyActor, const UPath* path ) const;
 
+	// Returns the shared cell set for this sequence, creating it if no live path uses it yet
+	TSharedPtr<const FInternedPathCells> InternPath( const TArray<FIntPoint>& cells );
+
 	void SetGoalActor( const TWeakObjectPtr<AActor>& goalActor )
 	{
 		GoalActor_ = goalActor;
@@ -100,5 +112,8 @@ private:
 	UPROPERTY()
 	TMap<FIntPoint, FPointsOnCell> PathPoints_;
 
+	// Sequence hash -> interned sequences with that hash; entries die with the last path using them
+	TMap<uint32, TArray<TWeakPtr<const FInternedPathCells>>> InternedPaths_;
+
 	bool bPointsVisible_ = false;
 };
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "AI/Path/PathPointsManager.h"
+
 #include "ProceduralMeshComponent.h"
 #include "Components/SplineComponent.h"
 #include "CoreMinimal.h"
@@ -7,60 +9,85 @@
 
 #include "SplinePointConnector.generated.h"
 
+struct FPathRenderSection
+{
+	// Keeps the interned sequence alive while it is drawn, so its address stays a valid key
+	TSharedPtr<const FInternedPathCells> Cells;
+	int32 Slot = INDEX_NONE;
+	int32 RefCount = 0;
+};
+
+/** Draws every visible unit path as one section of a procedural mesh.
+ * Paths share a section through the sequence interned by UPathPointsManager, and sections are spread over several
+ * small mesh components so adding or clearing one path only rebuilds the scene proxy of its own component */
 UCLASS( Abstract )
 class LORDS_FRONTIERS_API ASplinePointConnector : public AActor
 {
-    GENERATED_BODY()
+	GENERATED_BODY()
 
 public:
-    ASplinePointConnector();
+	ASplinePointConnector();
 
-    void AddPoint( FVector worldPosition, bool rebuild = false );
-    void RemovePoint( int32 index );
-    void BuildSpline();
-    void Clear();
+	// Adds a reference to the interned path (worldPoints are the centers of its cells).
+	// Returns false if the path is too short to draw
+	bool AcquirePath( const TSharedPtr<const FInternedPathCells>& cells, const TArray<FVector>& worldPoints );
 
-    int32 GetPointCount() const { return SplinePoints_.Num(); }
+	// Drops a reference taken by AcquirePath; the section is cleared when nobody uses it
+	void ReleasePath( const FInternedPathCells* cells );
+
+	void Clear();
+
+	int32 GetPathCount() const
+	{
+		return Sections_.Num();
+	}
 
 private:
-	virtual void BeginPlay() override;
+	int32 AllocateSlot();
+	UProceduralMeshComponent* GetMeshForSlot( int32 slot ) const;
 
-    void RebuildMesh();
-    void SampleLineVertices( float fromDist, float toDist, int32 samples,
-                             TArray<FVector>& vertices, TArray<FVector>& normals,
-                             TArray<FVector2D>& uvs, float totalLength ) const;
-    void BuildTriangles( int32 vertCount, TArray<int32>& triangles ) const;
+	void BuildSection( int32 slot, const TArray<FVector>& worldPoints );
+	void SampleLineVertices(
+	    float fromDist, float toDist, int32 samples, TArray<FVector>& vertices, TArray<FVector>& normals,
+	    TArray<FVector2D>& uvs, float totalLength
+	) const;
+	void BuildTriangles( int32 vertCount, TArray<int32>& triangles ) const;
 
-    UPROPERTY( EditAnywhere, Category = "Settings", meta = ( ClampMin = 0 ) )
-    float LineWidth_ = 15.f;
+	UPROPERTY( EditAnywhere, Category = "Settings", meta = ( ClampMin = 0 ) )
+	float LineWidth_ = 15.f;
 
-    UPROPERTY( EditAnywhere, Category = "Settings", meta = ( ClampMin = 0 ) )
-    float HeightOffset_ = 0.f;
+	UPROPERTY( EditAnywhere, Category = "Settings", meta = ( ClampMin = 0 ) )
+	float HeightOffset_ = 0.f;
 
-    UPROPERTY( EditAnywhere, Category = "Settings", meta = ( ClampMin = 1 ) )
-    int32 SampleCount_ = 64;
+	UPROPERTY( EditAnywhere, Category = "Settings", meta = ( ClampMin = 1 ) )
+	int32 SampleCount_ = 64;
 
-    UPROPERTY( EditAnywhere, Category = "Settings", meta = ( ClampMin = 0 ) )
-    float ArrowHeadLength_ = 80.f;
+	UPROPERTY( EditAnywhere, Category = "Settings", meta = ( ClampMin = 0 ) )
+	float ArrowHeadLength_ = 80.f;
 
-    UPROPERTY( EditAnywhere, Category = "Settings", meta = ( ClampMin = 0 ) )
-    float ArrowHeadWidth_ = 40.f;
+	UPROPERTY( EditAnywhere, Category = "Settings", meta = ( ClampMin = 0 ) )
+	float ArrowHeadWidth_ = 40.f;
 
 	UPROPERTY( EditAnywhere, Category = "Settings", meta = ( ClampMin = 0 ) )
 	float ArrowOffset_ = 0.f;
 
-    UPROPERTY( EditAnywhere, Category = "Settings" )
-    TObjectPtr<UMaterialInterface> LineMaterial_;
+	UPROPERTY( EditAnywhere, Category = "Settings" )
+	TObjectPtr<UMaterialInterface> LineMaterial_;
 
-    UPROPERTY()
-    TObjectPtr<USplineComponent> SplineComponent_;
-
-    UPROPERTY()
-    TObjectPtr<UProceduralMeshComponent> ProcMesh_;
+	// Scratch spline, rebuilt for each section that is generated
+	UPROPERTY()
+	TObjectPtr<USplineComponent> SplineComponent_;
 
-    UPROPERTY()
-    TArray<FVector> SplinePoints_;
+	UPROPERTY()
+	TObjectPtr<UProceduralMeshComponent> ProcMesh_;
 
+	// ProcMesh_ followed by the components added as the number of drawn paths grows
 	UPROPERTY()
-	float Height_ = 0.0f;
+	TArray<TObjectPtr<UProceduralMeshComponent>> ProcMeshes_;
+
+	TMap<const FInternedPathCells*, FPathRenderSection> Sections_;
+
+	TArray<int32> FreeSlots_;
+
+	int32 NextSlot_ = 0;
 };
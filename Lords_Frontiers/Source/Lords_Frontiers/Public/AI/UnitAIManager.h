@@ -69,6 +69,12 @@ public:
 		return SplineClass_;
 	}
 
+	// Shared renderer for all unit paths, spawned from SplineClass_
+	ASplinePointConnector* PathRenderer() const
+	{
+		return PathRenderer_;
+	}
+
 protected:
 	virtual void BeginPlay() override;
 
@@ -103,4 +109,7 @@ protected:
 
 	UPROPERTY()
 	TObjectPtr<UTargetBuildingTracker> TargetBuildingTracker_;
+
+	UPROPERTY()
+	TObjectPtr<ASplinePointConnector> PathRenderer_;
 };
@@ -64,6 +64,11 @@ public:
 	UFUNCTION( BlueprintCallable, Category = "Settings|Building" )
 	void ConfirmPlacing();
 
+	// Cursor-free counterparts of the placement flow, used by replay playback
+	bool PlaceBuildingAtCell( TSubclassOf<ABuilding> buildingClass, const FIntPoint& cellCoords );
+	bool RelocateBuildingToCell( const FIntPoint& fromCoords, const FIntPoint& toCoords );
+	bool RemoveBuildingAtCell( const FIntPoint& cellCoords );
+
 	UFUNCTION( BlueprintPure, Category = "Settings|Building" )
 	bool IsPlacing() const
 	{
@@ -187,6 +192,9 @@ private:
 
 	void UpdateHoveredCell();
 
+	// Places or relocates onto the given cell as if it were hovered
+	bool ConfirmPlacingAtCell( const FIntPoint& cellCoords );
+
 	void UpdatePreviewVisual( const FVector& worldLocation, bool bCanBuild );
 
 	void PlayPlacementAnimation( AActor* building );
@@ -2,11 +2,15 @@
 
 #include "CoreMinimal.h"
 
+class AStrategyCamera;
 class UObject;
 
 namespace CameraZoomUtils
 {
+	// Reads the per-frame value from UCameraViewSubsystem, falls back to the player pawn lookup.
 	float GetCameraZoomAlpha( const UObject* worldContextObject );
 
+	float ComputeZoomAlpha( const AStrategyCamera& strategyCam );
+
 	float ScaleFromZoomAlpha( float zoomAlpha, float minScale, float maxScale );
 }
@@ -67,6 +67,24 @@ protected:
 	UPROPERTY( EditAnywhere, BlueprintReadWrite, Category = "Settings|Animation" )
 	float TransitionSpeed = 5.0f;
 
+	// Materials place and face the clouds themselves from per-instance custom data
+	// (outward X, outward Y, roll) and the CloudHideFactor / CloudHideOffsetDown /
+	// CloudHideOffsetOutward scalar parameters. Instances are written only when generated.
+	UPROPERTY( EditAnywhere, BlueprintReadWrite, Category = "Settings|Animation" )
+	bool bAnimateInMaterial = false;
+
+	// CPU path: max instance transforms written per frame when only the camera facing changes. Zoom changes
+	// always rewrite every instance in one batch.
+	UPROPERTY( EditAnywhere, BlueprintReadWrite, Category = "Settings|Animation", meta = ( ClampMin = "1" ) )
+	int32 MaxInstanceUpdatesPerFrame = 64;
+
+	// Changes of zoom alpha / camera yaw below these are not worth rewriting instances.
+	UPROPERTY( EditAnywhere, BlueprintReadWrite, Category = "Settings|Animation" )
+	float AlphaUpdateTolerance = 0.005f;
+
+	UPROPERTY( EditAnywhere, BlueprintReadWrite, Category = "Settings|Animation" )
+	float RotationUpdateToleranceDeg = 0.5f;
+
 private:
 	UPROPERTY()
 	TArray<TObjectPtr<UInstancedStaticMeshComponent>> CloudISMCs;
@@ -74,5 +92,24 @@ private:
 	TArray<FCloudInstanceData> CloudsData;
 
 	void GenerateClouds();
+
+	FTransform MakeCloudTransform( const FCloudInstanceData& data, const FQuat& localRot ) const;
+
+	// Writes every instance with one batch per component.
+	void UpdateAllInstances( const FQuat& localRot );
+
+	// Writes the next slice of pending instances, marking only the touched components dirty.
+	void UpdateInstanceSlice( const FQuat& localRot );
+
+	void PushMaterialParameters();
+
 	float CurrentZoomAlpha = 0.0f;
+
+	// State the instances were last brought to (or are being brought to).
+	float AppliedZoomAlpha_ = -1.0f;
+	FQuat AppliedCameraRot_ = FQuat::Identity;
+
+	// Round-robin cursor into CloudsData and how many instances still need the current state.
+	int32 UpdateCursor_ = 0;
+	int32 PendingInstanceUpdates_ = 0;
 };
\ No newline at end of file
@@ -36,5 +36,5 @@ public:
 #endif
 
 private:
-	void ApplyDelta( const FCardEffectContext& context, float signedDelta ) const;
+	void ApplyDelta( const FCardEffectContext& context, bool bApply ) const;
 };
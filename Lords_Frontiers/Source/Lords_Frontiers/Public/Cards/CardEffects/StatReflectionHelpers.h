@@ -8,16 +8,12 @@
 
 namespace CardStatReflection
 {
-	inline FNumericProperty* FindNumericProperty( FName statName )
+	inline bool FindStat( FName statName, EStatsType& outStat )
 	{
-		if ( statName.IsNone() )
-		{
-			return nullptr;
-		}
-		FProperty* prop = FEntityStats::StaticStruct()->FindPropertyByName( statName );
-		return CastField<FNumericProperty>( prop );
+		return !statName.IsNone() && FEntityStats::FindStat( statName, outStat );
 	}
 
+	// Editor/UI text only; gameplay reads and writes go through the compiled accessors on FEntityStats.
 	inline FString GetStatDisplayName( FName statName )
 	{
 		if ( statName.IsNone() )
@@ -38,85 +34,45 @@ namespace CardStatReflection
 
 	inline double ReadStatValue( ABuilding* building, FName statName )
 	{
-		if ( !building )
-		{
-			return 0.0;
-		}
-		FNumericProperty* prop = FindNumericProperty( statName );
-		if ( !prop )
+		EStatsType statType;
+		if ( !building || !FindStat( statName, statType ) )
 		{
 			return 0.0;
 		}
-		FEntityStats& stats = building->Stats();
-		void* addr = prop->ContainerPtrToValuePtr<void>( &stats );
-
-		if ( prop->IsFloatingPoint() )
-		{
-			return prop->GetFloatingPointPropertyValue( addr );
-		}
-		return static_cast<double>( prop->GetSignedIntPropertyValue( addr ) );
+		return building->Stats().GetStatValue( statType );
 	}
 
-	inline float ApplyStatDelta( ABuilding* building, FName statName, float delta )
+	// Replaces whatever the source contributed to the stat before; zero removes the contribution.
+	inline bool SetStatModifier( ABuilding* building, FName statName, const FStatModifierSource& source, float value )
 	{
-		if ( !building || FMath::IsNearlyZero( delta ) )
-		{
-			return 0.f;
-		}
-		FNumericProperty* prop = FindNumericProperty( statName );
-		if ( !prop )
-		{
-			return 0.f;
-		}
-		FEntityStats& stats = building->Stats();
-		void* addr = prop->ContainerPtrToValuePtr<void>( &stats );
-
-		if ( prop->IsFloatingPoint() )
+		EStatsType statType;
+		if ( !building || !FindStat( statName, statType ) )
 		{
-			const double current = prop->GetFloatingPointPropertyValue( addr );
-			prop->SetFloatingPointPropertyValue( addr, current + delta );
-			return delta;
+			return false;
 		}
+		building->Stats().SetModifier( statType, source, value );
+		return true;
+	}
 
-		if ( prop->IsInteger() )
+	inline void RemoveStatModifier( ABuilding* building, FName statName, const FStatModifierSource& source )
+	{
+		EStatsType statType;
+		if ( building && FindStat( statName, statType ) )
 		{
-			const int64 current = prop->GetSignedIntPropertyValue( addr );
-			const int64 rounded = static_cast<int64>( FMath::RoundToInt( delta ) );
-			prop->SetIntPropertyValue( addr, current + rounded );
-			return static_cast<float>( rounded );
+			building->Stats().RemoveModifier( statType, source );
 		}
-
-		return 0.f;
 	}
 
+	// For previews on a copy of the stats: adds the delta directly, without a modifier.
 	inline bool ApplyStatDeltaToStats( FEntityStats& Stats, FName StatName, float SignedDelta )
 	{
-		if ( StatName.IsNone() || FMath::IsNearlyZero( SignedDelta ) )
-		{
-			return false;
-		}
-
-		FProperty* prop = FEntityStats::StaticStruct()->FindPropertyByName( StatName );
-		FNumericProperty* numericProp = CastField<FNumericProperty>( prop );
-		if ( !numericProp )
+		EStatsType statType;
+		if ( FMath::IsNearlyZero( SignedDelta ) || !FindStat( StatName, statType ) )
 		{
 			return false;
 		}
 
-		uint8* statsPtr = reinterpret_cast<uint8*>( &Stats );
-		void* valuePtr = numericProp->ContainerPtrToValuePtr<void>( statsPtr );
-
-		if ( numericProp->IsFloatingPoint() )
-		{
-			const double currentValue = numericProp->GetFloatingPointPropertyValue( valuePtr );
-			numericProp->SetFloatingPointPropertyValue( valuePtr, currentValue + SignedDelta );
-		}
-		else
-		{
-			const int64 currentValue = numericProp->GetSignedIntPropertyValue( valuePtr );
-			numericProp->SetIntPropertyValue( valuePtr, currentValue + FMath::RoundToInt( SignedDelta ) );
-		}
-
+		Stats.SetStatValue( statType, Stats.GetStatValue( statType ) + SignedDelta );
 		return true;
 	}
 }
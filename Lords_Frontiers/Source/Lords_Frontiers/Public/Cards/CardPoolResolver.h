@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 
 class UCardDataAsset;
+struct FRandomStream;
 
 /**
  * FCardRarityBucket
@@ -20,15 +21,55 @@ struct LORDS_FRONTIERS_API FCardRarityBucket
 	TArray<UCardDataAsset*> Cards;
 };
 
+/**
+ * FCardPoolResolver
+ *
+ * Keeps the weight influence of the applied-card history folded into per-card,
+ * per-category and per-tag multiplier tables. OnCardApplied updates them as cards
+ * are picked, so Resolve costs O(pool) to build its weights regardless of history
+ * length, and each pick is O(log n) through a Fenwick tree over the bucket weights.
+ */
 class LORDS_FRONTIERS_API FCardPoolResolver
 {
 public:
-	static TArray<UCardDataAsset*> Resolve(
+	// Folds one more stack of card into the tables; stackCount is the card's new total
+	void OnCardApplied( UCardDataAsset* card, int32 stackCount );
+
+	void Reset();
+
+	TArray<UCardDataAsset*> Resolve(
 		const TArray<FCardRarityBucket>& buckets,
-		const TArray<FAppliedCardRecord>& history,
 		int32 countToOffer,
 		int32 maxCardsPerRarity,
+		FRandomStream& rng,
 		int32 maxStacksForWeightInfluence = MAX_int32,
 		const TSet<UCardDataAsset*>& weightReducedCards = TSet<UCardDataAsset*>(),
 		float weightReductionMultiplier = 1.f );
+
+	// BaseWeight with every history multiplier applied; 0 when history excludes the card
+	float GetCardWeight( UCardDataAsset* card ) const;
+
+private:
+	// Multiplies the tables by source's multipliers raised to stackDelta
+	void ApplyInfluence( const UCardDataAsset* source, int32 stackDelta );
+
+	// Recomputes the multiplier tables from Stacks_ (after the stack cap changes)
+	void RebuildInfluence();
+
+	int32 GetEffectiveStacks( int32 stacks ) const;
+
+	// Applied stack count per card
+	TMap<UCardDataAsset*, int32> Stacks_;
+
+	// Cards listed in ExcludedCards of any applied card
+	TSet<UCardDataAsset*> Excluded_;
+
+	TMap<UCardDataAsset*, double> CardMultipliers_;
+	TMap<ECardCategory, double>   CategoryMultipliers_;
+	TMap<FName, double>           TagMultipliers_;
+
+	int32 MaxStacksForWeightInfluence_ = MAX_int32;
+
+	// Final weight per card, filled on demand and dropped whenever the tables change
+	mutable TMap<UCardDataAsset*, float> WeightCache_;
 };
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Cards/CardPoolResolver.h"
 #include "Cards/CardTypes.h"
 
 #include "CoreMinimal.h"
@@ -160,6 +161,9 @@ public:
 	UFUNCTION( BlueprintCallable, Category = "Cards|Unlocks" )
 	void ResetUnlocksToDefaults();
 
+	UFUNCTION( BlueprintPure, Category = "Cards|Unlocks" )
+	UCardDataAsset* FindCardByID( FName cardID ) const;
+
 	UFUNCTION( BlueprintPure, Category = "Cards|Unlocks" )
 	TArray<UCardDataAsset*> GetUnlockedCards() const;
 
@@ -230,6 +234,9 @@ private:
 	UPROPERTY()
 	TArray<FAppliedCardRecord> AppliedCardHistory_;
 
+	// Weight tables mirroring AppliedCardHistory_, updated as cards are applied
+	FCardPoolResolver CardPoolResolver_;
+
 	UPROPERTY()
 	TArray<TObjectPtr<UCardDataAsset>> AcquisitionLog_;
 
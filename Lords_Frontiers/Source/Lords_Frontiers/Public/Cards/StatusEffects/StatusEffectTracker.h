@@ -66,7 +66,4 @@ private:
 
 	UPROPERTY()
 	TArray<FActiveStatus> Active_;
-
-	float CachedOriginalMaxSpeed_ = -1.f;
-	float CachedOriginalAttackCooldown_ = -1.f;
 };
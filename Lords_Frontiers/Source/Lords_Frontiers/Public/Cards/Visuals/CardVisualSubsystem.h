@@ -153,6 +153,10 @@ private:
 
 	TMap<TWeakObjectPtr<AActor>, ACardIconStrip*> ActiveStripsByHost_;
 
+	// Zoom generation the active strips/popups were last scaled for; new ones mark the scale dirty.
+	uint64 AppliedZoomGeneration_ = 0;
+	bool bCameraScaleDirty_ = true;
+
 	UPROPERTY()
 	TArray<FCardStickyRecord> Stickies_;
 
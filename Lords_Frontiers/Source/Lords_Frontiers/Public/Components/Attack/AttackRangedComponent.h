@@ -95,6 +95,11 @@ public:
 		return TargetPriority_;
 	}
 
+	TSubclassOf<ABaseProjectile> ProjectileClass() const
+	{
+		return ProjectileClass_;
+	}
+
 protected:
 	virtual void OnRegister() override;
 
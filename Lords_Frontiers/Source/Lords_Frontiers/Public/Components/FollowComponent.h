@@ -32,7 +32,7 @@ protected:
 	void MoveTowardsTarget( float deltaTime );
 	virtual void SnapToGround() const;
 	void Sway( float deltaTime );
-	void ResolveUnitOnUnwalkableCell();
+	void ResolveUnitOnUnwalkableCell( float deltaTime );
 
 	virtual FVector ProjectMoveLocation( const FVector& location ) const
 	{
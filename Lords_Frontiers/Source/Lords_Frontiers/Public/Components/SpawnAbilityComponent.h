@@ -9,6 +9,7 @@
 
 class UNiagaraSystem;
 class AUnit;
+class USpawnSchedulerSubsystem;
 class UUnitBuilder;
 
 UCLASS( ClassGroup = ( Unit ), meta = ( BlueprintSpawnableComponent ) )
@@ -19,20 +20,24 @@ class LORDS_FRONTIERS_API USpawnAbilityComponent : public UActorComponent
 public:
 	float TimeUntilGroupSpawnStart() const;
 
+	// Called by USpawnSchedulerSubsystem each frame: starts due groups, queues due minions, resumes the owner
+	void AdvanceSchedule( double now, USpawnSchedulerSubsystem& scheduler );
+
+	// Spawns one minion queued by AdvanceSchedule; false when nothing was spawned
+	bool SpawnQueuedUnit( UUnitBuilder& builder, bool bRequireTarget ) const;
+
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay( const EEndPlayReason::Type endPlayReason ) override;
 
-	void GroupSpawnTick();
-	void UnitSpawnTick();
-
-	void ProcessSpawn() const;
+	void StartGroup( double groupTime );
 
-	void SpawnUnit() const;
+	float StopTime() const;
 
 	void StopUnitMovementAndAttack() const;
 	void ResumeUnitMovementAndAttack() const;
 
-	FTransform FindValidTransform() const;
+	FTransform FindValidTransform( const UUnitBuilder& builder ) const;
 
 	void ResolveVFXDefaults();
 
@@ -57,12 +62,14 @@ protected:
 	UPROPERTY( EditDefaultsOnly, Category = "Settings", meta = ( ClampMin = 0, Units = "s" ) )
 	float StopTimeBeforeSpawn_ = 0.0f;
 
-	UPROPERTY()
-	TObjectPtr<UUnitBuilder> UnitBuilder_;
+	// World time of the next group, negative while not scheduled
+	double NextGroupTime_ = -1.0;
+
+	// World time the stopped owner moves again, negative while it is not stopped by this component
+	double ResumeTime_ = -1.0;
 
-	FTimerHandle GroupSpawnTimer_;
-	FTimerHandle UnitSpawnTimer_;
-	FTimerHandle MovementTimer_;
+	double NextUnitTime_ = 0.0;
+	int32 UnitsLeft_ = 0;
 
 	UPROPERTY()
 	TObjectPtr<UNiagaraSystem> ResolvedSpawnAbilityVFX_;
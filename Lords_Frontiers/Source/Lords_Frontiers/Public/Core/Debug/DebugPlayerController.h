@@ -42,6 +42,14 @@ public:
 	UFUNCTION( Exec )
 	void Card_ResetUnlocks();
 
+	// Combat speed, above 8 runs the fixed-step fast-forward (up to 64)
+	UFUNCTION( Exec )
+	void Sim_Speed( float speed );
+
+	// Restarts the recorded map and plays the replay file back (path relative to Saved/Replays or absolute)
+	UFUNCTION( Exec )
+	void Replay_Play( const FString& path );
+
 	UPROPERTY()
 	TObjectPtr<UGameHUDWidget> GameHUDWidget_ = nullptr;
 
@@ -101,6 +101,9 @@ private:
 	void EnterDefeatPhase();
 	void CleanupBattlefield();
 
+	// SetGameSpeed without recording it as a player command
+	void ApplyGameSpeed( float newSpeed );
+
 	UFUNCTION()
 	void HandlePhaseChanged( EGameLoopPhase oldPhase, EGameLoopPhase newPhase );
 
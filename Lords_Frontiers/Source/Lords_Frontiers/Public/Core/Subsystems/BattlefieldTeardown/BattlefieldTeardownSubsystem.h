@@ -0,0 +1,31 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "BattlefieldTeardownSubsystem.generated.h"
+
+/**
+ * Marks the span in which UGameSessionController::CleanupBattlefield tears this world's battlefield down in bulk.
+ * While it is set, units and their components skip per-actor unregistration, because the owning registries
+ * (path renderer, significance, health bars, status visuals, logger trackers) are cleared in one pass afterwards.
+ */
+UCLASS()
+class LORDS_FRONTIERS_API UBattlefieldTeardownSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem( UObject* outer ) const override;
+
+	// False when the context has no world or the world has no teardown subsystem
+	static bool IsBulkTeardown( const UObject* worldContextObject );
+
+	void SetBulkTeardown( const bool bBulkTeardown )
+	{
+		bBulkTeardown_ = bBulkTeardown;
+	}
+
+private:
+	bool bBulkTeardown_ = false;
+};
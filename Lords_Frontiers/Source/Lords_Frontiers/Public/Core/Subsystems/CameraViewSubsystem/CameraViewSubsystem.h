@@ -0,0 +1,56 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ConvexVolume.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "CameraViewSubsystem.generated.h"
+
+class AStrategyCamera;
+
+// Snapshot of the player view, published once per frame by AStrategyCamera::Tick.
+struct FCameraViewState
+{
+	float ZoomAlpha = 0.5f;
+
+	FMatrix ViewProjectionMatrix = FMatrix::Identity;
+	FIntRect ViewRect;
+	FConvexVolume Frustum;
+
+	// Bumped only when ZoomAlpha changes; consumers compare it to skip rescaling.
+	uint64 ZoomGeneration = 0;
+
+	// Bumped when the view-projection matrix or view rect changes.
+	uint64 ViewGeneration = 0;
+
+	bool bHasView = false;
+};
+
+/**
+ * Per-frame cache of camera zoom and view data. Game-thread only: written by the camera tick,
+ * read by widgets and subsystems that would otherwise look up the pawn and recompute every call.
+ */
+UCLASS()
+class LORDS_FRONTIERS_API UCameraViewSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Returns nullptr until the camera has published at least once.
+	static const FCameraViewState* FindState( const UObject* worldContextObject );
+
+	const FCameraViewState& GetState() const
+	{
+		return State_;
+	}
+
+	bool HasPublished() const
+	{
+		return State_.ZoomGeneration > 0;
+	}
+
+	void Publish( const AStrategyCamera& camera );
+
+private:
+	FCameraViewState State_;
+};
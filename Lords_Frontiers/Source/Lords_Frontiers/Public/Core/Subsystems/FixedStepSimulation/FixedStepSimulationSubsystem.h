@@ -0,0 +1,97 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "FixedStepSimulationSubsystem.generated.h"
+
+/**
+ * Fast-forward beyond what time dilation can do.
+ * While active, every tick of this world advances the game by exactly one fixed step (the world's undilated frame
+ * time is clamped to cStepSeconds), so movement, projectiles, attack cooldowns, status effects and spawn timers run
+ * at their normal resolution and produce the same result at any speed. The engine frame ticks the world once as
+ * usual; at the end of the frame the subsystem ticks it again as many times as the requested speed needs, within a
+ * wall-time budget so the rendered frame rate stays usable. When the machine cannot keep up the effective speed
+ * drops, the simulation does not change. The extra ticks are simulation only: player controllers and their pawns
+ * (input and the camera, which run on real frame time) are held to the engine's own tick.
+ */
+UCLASS()
+class LORDS_FRONTIERS_API UFixedStepSimulationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	virtual void Tick( float deltaTime ) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickableInEditor() const override
+	{
+		return false;
+	}
+	virtual bool IsTickable() const override
+	{
+		return bActive_;
+	}
+
+	// Speeds up to this are left to world time dilation
+	static constexpr float cMaxDilatedSpeed = 8.0f;
+
+	static constexpr float cMaxSpeed = 64.0f;
+
+	// Game time simulated per world tick while fast-forwarding
+	static constexpr double cStepSeconds = 1.0 / 30.0;
+
+	// Enters fixed-step mode at the given speed (clamped to cMaxSpeed)
+	void Start( float speed );
+
+	void Stop();
+
+	bool IsActive() const
+	{
+		return bActive_;
+	}
+
+	float GetTargetSpeed() const
+	{
+		return bActive_ ? TargetSpeed_ : 1.0f;
+	}
+
+	// Game seconds per wall second actually reached, smoothed
+	float GetEffectiveSpeed() const
+	{
+		return bActive_ ? EffectiveSpeed_ : 1.0f;
+	}
+
+	uint64 GetStepCount() const
+	{
+		return StepCount_;
+	}
+
+private:
+	// Runs the extra world ticks once the engine frame is done, outside of any world tick
+	void HandleEndFrame();
+
+	bool bActive_ = false;
+
+	float TargetSpeed_ = 1.0f;
+
+	float EffectiveSpeed_ = 1.0f;
+
+	uint64 StepCount_ = 0;
+
+	// Steps owed to the target speed and not run yet; dropped when it grows past what a frame can catch up
+	double StepDebt_ = 0.0;
+
+	double LastFrameWallTime_ = 0.0;
+
+	// Set while HandleEndFrame ticks the world itself
+	bool bInExtraSteps_ = false;
+
+	FDelegateHandle EndFrameHandle_;
+
+	// World settings restored on Stop
+	float PrevMinUndilatedFrameTime_ = 0.0f;
+
+	float PrevMaxUndilatedFrameTime_ = 0.0f;
+};
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
 #include "UObject/WeakObjectPtr.h"
 
 #include "HealthBarPoolSubsystem.generated.h"
@@ -31,6 +32,9 @@ struct FActiveHealthBar
 	UPROPERTY()
 	TWeakObjectPtr<AActor> Entity;
 
+	// Stable map key, still valid after the entity is gone.
+	TObjectKey<AActor> EntityKey;
+
 	UPROPERTY()
 	TObjectPtr<UHealthBarWidget> Widget;
 
@@ -45,8 +49,19 @@ struct FActiveHealthBar
 	float HideTimer = 0.0f;
 
 	uint64 TouchOrder = 0;
+
+	// Camera zoom generation the widget scale was last computed for; 0 = never applied.
+	uint64 AppliedZoomGeneration = 0;
+
+	// Health changed since the last widget write; flushed once per frame in Tick.
+	bool bHealthDirty = false;
+
+	// Off-screen or too small: widget returned to the pool, timers keep running.
+	bool bCulled = false;
 };
 
+struct FCameraViewState;
+
 UCLASS()
 class LORDS_FRONTIERS_API UHealthBarPoolSubsystem : public UTickableWorldSubsystem
 {
@@ -66,24 +81,33 @@ public:
 
 	void PreWarm( TSubclassOf<UHealthBarWidget> widgetClass, int32 count );
 
+	// Warms the widget class entity would get from config, unless it is warm already (entity may be a CDO)
+	void PreWarmFor( AActor* entity, UHealthBarConfigDataAsset* config );
+
 	void ShowFor( AActor* entity, UHealthBarConfigDataAsset* config );
 
 	void HideFor( AActor* entity );
 
+	// Returns the widgets of every destroyed entity to the pools now instead of over the next ticks.
+	void ReleaseStaleBars();
+
 	int32 GetActiveCount() const
 	{
-		return ActiveBars_.Num();
+		return Bars_.Num();
 	}
 
 	int32 GetPooledCount( TSubclassOf<UHealthBarWidget> widgetClass ) const;
 
 private:
-	UHealthBarWidget* AcquireWidget( TSubclassOf<UHealthBarWidget> widgetClass );
+	UHealthBarWidget* AcquireWidget( TSubclassOf<UHealthBarWidget> widgetClass, bool bAllowEviction = true );
 
 	void ReleaseWidget( UHealthBarWidget* widget );
 
 	TSubclassOf<UHealthBarWidget> ResolveWidgetClass( AActor* entity, UHealthBarConfigDataAsset* config ) const;
 
+	// First use of a widget class fills its pool with config's PoolSize_
+	void WarmClass( TSubclassOf<UHealthBarWidget> widgetClass, const UHealthBarConfigDataAsset& config );
+
 	bool IsBoss( AActor* entity ) const;
 
 	UHealthBarWidget* EvictOldest( TSubclassOf<UHealthBarWidget> widgetClass );
@@ -96,13 +120,29 @@ private:
 
 	UGameHUDWidget* ResolveHUD() const;
 
+	// Removes Bars_[index] (swap with last), releasing its widget and component.
+	void RemoveBarAt( int32 index );
+
+	// Decides whether a world bar is worth a widget this frame and culls/restores it.
+	void UpdateBarLod( FActiveHealthBar& bar, AActor* entity, const FCameraViewState& viewState );
+
+	void CullBar( FActiveHealthBar& bar );
+
+	void RestoreBar( FActiveHealthBar& bar, AActor* entity );
+
 	UPROPERTY()
 	TMap<TSubclassOf<UHealthBarWidget>, FHealthBarPool> Pools_;
 
+	// Dense active bars; BarIndexByEntity_ maps an entity to its slot.
 	UPROPERTY()
-	TMap<TWeakObjectPtr<AActor>, FActiveHealthBar> ActiveBars_;
+	TArray<FActiveHealthBar> Bars_;
+
+	TMap<TObjectKey<AActor>, int32> BarIndexByEntity_;
+
+	TMap<TObjectKey<AActor>, float> LastDisplayedPercent_;
 
-	TMap<TWeakObjectPtr<AActor>, float> LastDisplayedPercent_;
+	// Widgets currently handed out to bars (culled bars hold none).
+	int32 OutstandingWidgets_ = 0;
 
 	uint64 TouchCounter_ = 0;
 
@@ -6,24 +6,41 @@
 #include "Subsystems/GameInstanceSubsystem.h"
 
 #include "CoreMinimal.h"
+#include "Engine/StreamableManager.h"
 
 #include "LevelSubsystem.generated.h"
 
 enum class ELevelStatus;
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam( FOnLevelPreloadProgress, float, Progress );
+
 /** (Gregory-hub)
- * Subsystem for level loading */
+ * Subsystem for level loading
+ *
+ * Gameplay levels open only after their preload manifest (the game content the level references, hard and soft)
+ * has streamed in asynchronously, so the current menu keeps running while it loads and nothing the level uses is
+ * loaded lazily in the middle of combat. The preload stays resident while the level runs (card visuals, for one, are
+ * only used after the first reward) and is released when the level is left: on the next preload, the main menu or
+ * shutdown. The manifest reads the asset registry's dependency graph, which cooked builds only carry because
+ * DefaultEngine.ini sets [AssetRegistry] bSerializeDependencies. */
 UCLASS()
 class LORDS_FRONTIERS_API ULevelSubsystem : public UGameInstanceSubsystem
 {
 	GENERATED_BODY()
 
 public:
-	void LoadMainMenu() const;
-	void LoadLevelChoosingLevel() const;
+	virtual void Deinitialize() override;
+
+	void LoadMainMenu();
+	void LoadLevelChoosingLevel();
 	void LoadGameplayLevel( int index );
 	void LoadNextLevel();
 
+	// Starts streaming the level's assets without opening it (e.g. when the level is selected in a menu)
+	void PreloadGameplayLevel( int index );
+
+	bool IsPreloading() const;
+
 	void SetLevels( TSoftObjectPtr<ULevelsDataAsset> levels );
 	void ResetSavedLevelStatuses() const;
 
@@ -31,11 +48,34 @@ public:
 
 	void UnlockNextLevel() const;
 
+	// 0..1 while a gameplay level streams in; reaches 1 right before the level opens
+	UPROPERTY( BlueprintAssignable, Category = "Levels" )
+	FOnLevelPreloadProgress OnPreloadProgress;
+
 protected:
 	UPROPERTY()
 	TObjectPtr<ULevelsDataAsset> Levels_;
 
 	void LoadLevel( TSoftObjectPtr<UWorld> level, const FString& errorMessage = "" ) const;
 
+	// Opens the gameplay level once its preload has completed
+	void PreloadAndOpenGameplayLevel( int index );
+
+	const TArray<FSoftObjectPath>& GetPreloadManifest( int index );
+
+	void HandlePreloadUpdate( TSharedRef<FStreamableHandle> handle ) const;
+	void HandlePreloadCompleted( int index );
+
+	void ReleasePreload();
+
 	int CurrentLevelIndex_ = -1;
+
+	// Built from the asset registry on first use, per gameplay level index
+	TMap<int, TArray<FSoftObjectPath>> PreloadManifests_;
+
+	TSharedPtr<FStreamableHandle> PreloadHandle_;
+	int PreloadLevelIndex_ = INDEX_NONE;
+
+	// Gameplay level waiting for its preload to open
+	int PendingOpenIndex_ = INDEX_NONE;
 };
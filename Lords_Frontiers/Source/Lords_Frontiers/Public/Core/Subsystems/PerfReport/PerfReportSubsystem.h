@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Core/GameLoop/GameLoopManager.h"
+#include "Utilities/GameplayStats.h"
+
+#include "Containers/StaticArray.h"
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "PerfReportSubsystem.generated.h"
+
+// Peak and running sum of a per-frame level (units alive, projectiles in flight, ...)
+struct FPerfCounterSamples
+{
+	int32 Peak = 0;
+	int64 Sum = 0;
+
+	void Add( const int32 value )
+	{
+		Peak = FMath::Max( Peak, value );
+		Sum += value;
+	}
+};
+
+/**
+ * Samples the gameplay scopes from GameplayStats.h once per frame during combat and logs, when the wave's combat
+ * ends, the min / avg / p99 / max milliseconds per frame of each system along with the unit, projectile, status
+ * effect and path counters. Also publishes the level counters to `stat LordsFrontiers`.
+ */
+UCLASS()
+class LORDS_FRONTIERS_API UPerfReportSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem( UObject* outer ) const override;
+	virtual void OnWorldBeginPlay( UWorld& inWorld ) override;
+	virtual void Deinitialize() override;
+
+	virtual void Tick( float deltaTime ) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickableInEditor() const override
+	{
+		return false;
+	}
+	virtual bool IsTickable() const override
+	{
+		return GameLoopManager_ != nullptr;
+	}
+
+private:
+	UFUNCTION()
+	void HandlePhaseChanged( EGameLoopPhase oldPhase, EGameLoopPhase newPhase );
+
+	void BeginWave( int32 wave );
+	void ReportWave();
+
+	UPROPERTY()
+	TObjectPtr<UGameLoopManager> GameLoopManager_;
+
+	bool bSampling_ = false;
+	int32 Wave_ = 0;
+	int32 Frames_ = 0;
+
+	// Milliseconds spent per frame, one entry per combat frame
+	TStaticArray<TArray<float>, FGameplayPerf::cSystemCount> FrameMs_;
+
+	FPerfCounterSamples Units_;
+	FPerfCounterSamples Projectiles_;
+	FPerfCounterSamples StatusEffects_;
+	int32 PathComputations_ = 0;
+};
@@ -49,6 +49,9 @@ public:
 
 	void FinalizeReturn( ABaseProjectile* projectile );
 
+	// Puts every projectile still in flight or fading its trail back into the pools immediately.
+	void ReturnAllActive();
+
 	void PreWarmPool( TSubclassOf<ABaseProjectile> projectileClass, int32 conut );
 
 	void PreWarmPools( const TArray<FPoolWarmupConfig>& Cconfigs );
@@ -57,6 +60,9 @@ public:
 
 	int32 GetPooledCount( TSubclassOf<ABaseProjectile> projectileClass ) const;
 
+	// Projectiles of every class currently out of the pools
+	int32 GetTotalActiveCount() const;
+
 private:
 	ABaseProjectile* CreateNewProjectile( TSubclassOf<ABaseProjectile> projectileClass );
 
@@ -0,0 +1,154 @@
+#pragma once
+
+#include "Core/GameLoop/GameLoopManager.h"
+#include "Core/GameSessionController.h"
+#include "Core/Subsystems/Replay/ReplayTypes.h"
+
+#include "CoreMinimal.h"
+#include "Engine/EngineBaseTypes.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+
+#include "ReplaySubsystem.generated.h"
+
+class ABuilding;
+class UCardDataAsset;
+
+struct FReplayWaveTiming
+{
+	int32 Wave = 0;
+	double GameSeconds = 0.0;
+	double WallSeconds = 0.0;
+	int32 Frames = 0;
+	uint32 StateHash = 0;
+};
+
+/**
+ * Input-level replays.
+ *
+ * Recording (on unless -NoReplayRecord is given): the player commands issued through ABuildManager, UCardSubsystem,
+ * UGameLoopManager and UGameSessionController are recorded with the world tick they were issued at, together with
+ * the session seed, the game delta of every world tick and a state hash per wave. The file is written to
+ * Saved/Replays/ when the match ends; only the newest cMaxSavedReplays files are kept.
+ *
+ * Playback (-ReplayPlayback=<file> on the command line, or StartPlayback) restarts the recorded map with the recorded
+ * seed, pins the fixed-step fast-forward at its top speed and forces every world tick to the recorded delta, so the
+ * simulation matches the recording whatever speed it was played at. Commands are fed back at their tick and each
+ * wave's state hash is checked against the recorded one. Run it with -nullrhi for a headless run; the process exits
+ * once the match ends when playback came from the command line.
+ */
+UCLASS()
+class LORDS_FRONTIERS_API UReplaySubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static constexpr int32 cMaxSavedReplays = 20;
+
+	static UReplaySubsystem* Get( const UObject* worldContextObject );
+
+	virtual void Initialize( FSubsystemCollectionBase& collection ) override;
+	virtual void Deinitialize() override;
+
+	bool StartPlayback( const FString& path );
+
+	bool IsPlayingBack() const
+	{
+		return bPlayingBack_;
+	}
+
+	const TArray<FReplayWaveTiming>& GetWaveTimings() const
+	{
+		return WaveTimings_;
+	}
+
+	// Order-independent hash of buildings, units, resources and picked cards
+	uint32 ComputeStateHash() const;
+
+	// Recording hooks, called by the systems that execute the commands
+	void RecordPlaceBuilding( TSubclassOf<ABuilding> buildingClass, const FIntPoint& cell );
+	void RecordRelocateBuilding( const FIntPoint& fromCell, const FIntPoint& toCell );
+	void RecordRemoveBuilding( const FIntPoint& cell );
+	void RecordEndBuildTurn();
+	void RecordStartCombatEarly();
+	void RecordRerollCards( int32 rerollIndex );
+	void RecordApplyCards( const TArray<UCardDataAsset*>& cards );
+	void RecordSetSpeed( float speed );
+
+private:
+	UFUNCTION()
+	void HandlePhaseChanged( EGameLoopPhase oldPhase, EGameLoopPhase newPhase );
+
+	UFUNCTION()
+	void HandleGameEnded( EGameResult result );
+
+	void HandlePostLoadMap( UWorld* loadedWorld );
+
+	// Playback: runs the commands due before this tick and forces the tick to its recorded delta
+	void HandleWorldTickStart( UWorld* world, ELevelTick tickType, float deltaSeconds );
+
+	// Recording: stores the delta the tick ran with. Both directions count the session's ticks here
+	void HandleWorldPostActorTick( UWorld* world, ELevelTick tickType, float deltaSeconds );
+
+	bool IsSessionWorld( const UWorld* world ) const;
+
+	void BeginSession();
+	void EndSession( EGameResult result );
+
+	FReplayCommand& AddCommand( EReplayCommandType type );
+
+	void SaveRecording( const TCHAR* outcome );
+	void PruneSavedReplays( const FString& directory ) const;
+	void ExecuteCommand( const FReplayCommand& command );
+	void FinishPlayback( EGameResult result );
+
+	// Restores the frame time clamp playback overrides
+	void RestoreFrameTimeClamp();
+
+	UPROPERTY()
+	TObjectPtr<UGameLoopManager> GameLoopManager_;
+
+	UPROPERTY()
+	TObjectPtr<UGameSessionController> SessionController_;
+
+	FReplayFile Replay_;
+
+	bool bSessionActive_ = false;
+	bool bPlayingBack_ = false;
+
+	// Playback came from the command line: quit when the match ends
+	bool bExitWhenDone_ = false;
+
+	// Playback was requested before any world existed; the first loaded map decides whether to switch maps
+	bool bAwaitingMap_ = false;
+
+	// -NoReplayRecord turns recording off
+	bool bRecordingEnabled_ = true;
+
+	int32 Cursor_ = 0;
+	int32 SkippedCommands_ = 0;
+
+	// Unpaused world ticks completed since the session began
+	int32 SessionFrame_ = 0;
+
+	// The current world tick started inside the session and is counted when it finishes
+	bool bInSessionTick_ = false;
+
+	int32 VerifiedWaves_ = 0;
+	int32 DivergedWaves_ = 0;
+
+	double CombatStartGameTime_ = 0.0;
+	double CombatStartWallTime_ = 0.0;
+	int32 CombatStartFrame_ = 0;
+	double SessionStartWallTime_ = 0.0;
+
+	TArray<FReplayWaveTiming> WaveTimings_;
+
+	// World frame time clamp before playback took it over
+	bool bFrameTimeClampSaved_ = false;
+	float PrevMinUndilatedFrameTime_ = 0.0f;
+	float PrevMaxUndilatedFrameTime_ = 0.0f;
+
+	FDelegateHandle PostLoadMapHandle_;
+	FDelegateHandle WorldTickStartHandle_;
+	FDelegateHandle WorldPostActorTickHandle_;
+};
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+enum class EReplayCommandType : uint8
+{
+	PlaceBuilding,    // Args: class path index, cell x, cell y
+	RelocateBuilding, // Args: from x, from y, to x, to y
+	RemoveBuilding,   // Args: cell x, cell y
+	EndBuildTurn,
+	StartCombatEarly,
+	RerollCards,      // Args: reroll index
+	ApplyCards,       // Args: card id indices
+	SetSpeed,         // Args: speed in hundredths
+	Count
+};
+
+/**
+ * One player command. Tick is the number of world ticks completed since the session began; playback runs the command
+ * right before the next world tick, as the player's input was. Wave and phase are kept to detect a diverged playback.
+ */
+struct FReplayCommand
+{
+	EReplayCommandType Type = EReplayCommandType::EndBuildTurn;
+	uint8 Phase = 0;
+	int32 Wave = 0;
+	int32 Tick = 0;
+
+	// Non-negative; strings (class paths, card ids) are indices into FReplayFile::Strings
+	TArray<int32, TInlineAllocator<4>> Args;
+};
+
+/**
+ * A recorded match: seed, map, the player commands, the game delta of every world tick and a state hash per wave.
+ * Playback replays the deltas exactly, so the file is independent of the speed and frame rate it was recorded at.
+ * The deltas dominate the size: runs of equal deltas (fixed-step fast-forward, capped frame rates) are stored once,
+ * but an uncapped variable frame rate still costs about three bytes per world tick, several hundred kilobytes for a
+ * long match. They are kept lossless because any rounding would change what playback simulates.
+ */
+struct FReplayFile
+{
+	static constexpr uint32 cMagic = 0x5052464C; // "LFRP"
+	static constexpr uint16 cVersion = 3;
+
+	int32 SessionSeed = 0;
+	FString MapName;
+	TArray<FString> Strings;
+	TArray<FReplayCommand> Commands;
+
+	// Game seconds of each unpaused world tick since the session began
+	TArray<float> FrameDeltas;
+
+	// UReplaySubsystem::ComputeStateHash at the end of each combat phase, in order
+	TArray<uint32> WaveHashes;
+
+	// Index of the string in the table, adding it on first use
+	int32 InternString( const FString& value );
+
+	const FString& GetString( int32 index ) const;
+
+	void Reset();
+
+	bool Serialize( FArchive& ar );
+
+	bool SaveToFile( const FString& path );
+	bool LoadFromFile( const FString& path );
+};
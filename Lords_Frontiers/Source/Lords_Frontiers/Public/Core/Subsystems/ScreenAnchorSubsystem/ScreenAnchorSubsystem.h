@@ -0,0 +1,78 @@
+#pragma once
+
+#include "Components/SlateWrapperTypes.h"
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "ScreenAnchorSubsystem.generated.h"
+
+class UWidget;
+
+/**
+ * Registry of canvas widgets anchored to world locations.
+ * Projects all anchors in one pass per frame with the view-projection cached by UCameraViewSubsystem,
+ * collapses anchors that fall off screen and writes slot positions only when they moved by at least a pixel.
+ * Widgets must live in a UCanvasPanel slot.
+ */
+UCLASS()
+class LORDS_FRONTIERS_API UScreenAnchorSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Tick( float deltaTime ) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickableInEditor() const override
+	{
+		return false;
+	}
+	virtual bool IsTickableWhenPaused() const override
+	{
+		return true;
+	}
+	virtual bool IsTickable() const override
+	{
+		return Widgets_.Num() > 0;
+	}
+
+	// Adds or re-anchors a widget. visibleState is applied whenever the anchor is on screen.
+	void RegisterAnchor(
+	    UWidget* widget, const FVector& worldLocation,
+	    ESlateVisibility visibleState = ESlateVisibility::HitTestInvisible
+	);
+
+	void UnregisterAnchor( UWidget* widget );
+
+	// Projects immediately instead of waiting for the next tick (e.g. right after registering).
+	void FlushAnchors();
+
+	int32 GetAnchorCount() const
+	{
+		return Widgets_.Num();
+	}
+
+private:
+	void ProjectAll();
+
+	void ApplyResults();
+
+	void RemoveAt( int32 index );
+
+	// Structure of arrays, same index across all of them.
+	TArray<FVector> WorldLocations_;
+	TArray<TWeakObjectPtr<UWidget>> Widgets_;
+	TArray<ESlateVisibility> VisibleStates_;
+	TArray<FVector2D> AppliedPositions_;
+	TBitArray<> AppliedOnScreen_;
+	TBitArray<> NeverApplied_;
+
+	// Scratch output of the projection pass.
+	TArray<FVector2D> ProjectedPositions_;
+	TBitArray<> ProjectedOnScreen_;
+
+	TMap<TWeakObjectPtr<UWidget>, int32> IndexByWidget_;
+
+	uint64 ProjectedViewGeneration_ = 0;
+	float ProjectedViewportScale_ = 0.0f;
+	bool bAnchorsDirty_ = false;
+};
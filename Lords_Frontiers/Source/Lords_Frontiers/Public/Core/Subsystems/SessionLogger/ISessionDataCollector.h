@@ -6,6 +6,7 @@
 #include "ISessionDataCollector.generated.h"
 
 enum class EGameLoopPhase : uint8;
+struct FSessionDamageRecord;
 
 UINTERFACE( MinimalAPI, BlueprintType )
 class USessionDataCollector : public UInterface
@@ -41,6 +42,12 @@ public:
 	{
 	}
 
+	// Damage hits since the previous batch, oldest first. Delivered at most once per frame, and before any
+	// phase, wave or turn callback so batches never straddle them.
+	virtual void OnDamageEvents( TArrayView<const FSessionDamageRecord> records )
+	{
+	}
+
 	virtual void AppendToJson( TSharedPtr<FJsonObject> rootJson )
 	{
 	}
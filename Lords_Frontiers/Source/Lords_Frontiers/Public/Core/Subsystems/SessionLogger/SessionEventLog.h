@@ -0,0 +1,218 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tasks/Pipe.h"
+#include "Templates/UniquePtr.h"
+
+class FArchive;
+
+/**
+ * Columnar binary session log (.lfslog).
+ *
+ * Layout: header (magic, version, map, timestamp, seed), then a stream of chunks. A table chunk holds up to
+ * cRowsPerChunk rows of one event table, stored column by column and zlib-compressed. A names chunk appends to the
+ * name table that the uint16 class columns index into; it is written before any chunk that uses the new names, so a
+ * file cut off by a crash is still readable up to its last complete chunk. An end chunk closes the session with its
+ * outcome.
+ */
+namespace SessionEventLog
+{
+	constexpr uint32 cMagic = 0x474C534C; // "LSLG"
+	constexpr uint16 cVersion = 1;
+	constexpr int32 cRowsPerChunk = 4096;
+
+	// Flags column bits
+	constexpr uint8 cFlagSplash = 1 << 0;
+	constexpr uint8 cFlagFromTower = 1 << 1;
+	constexpr uint8 cFlagBuilding = 1 << 2;
+	// Set on the hit that took the target's last health
+	constexpr uint8 cFlagKill = 1 << 3;
+}
+
+enum class ESessionEventTable : uint8
+{
+	Damage,
+	Death,
+	Placement,
+	Resources,
+	Phase,
+	Count
+};
+
+// Columns shared by every table: game seconds since the session started and the wave number
+struct FSessionEventRowKey
+{
+	TArray<float> Time;
+	TArray<uint16> Wave;
+
+	template <typename TFunc>
+	void ForEachColumn( TFunc&& func )
+	{
+		func( Time );
+		func( Wave );
+	}
+};
+
+struct FSessionDamageColumns : FSessionEventRowKey
+{
+	TArray<uint16> Source;
+	TArray<uint16> Target;
+	TArray<int32> Amount;
+	TArray<uint8> Flags;
+
+	template <typename TFunc>
+	void ForEachColumn( TFunc&& func )
+	{
+		FSessionEventRowKey::ForEachColumn( func );
+		func( Source );
+		func( Target );
+		func( Amount );
+		func( Flags );
+	}
+};
+
+struct FSessionDeathColumns : FSessionEventRowKey
+{
+	TArray<uint16> Victim;
+	TArray<uint16> Killer;
+	TArray<uint8> Flags;
+
+	template <typename TFunc>
+	void ForEachColumn( TFunc&& func )
+	{
+		FSessionEventRowKey::ForEachColumn( func );
+		func( Victim );
+		func( Killer );
+		func( Flags );
+	}
+};
+
+struct FSessionPlacementColumns : FSessionEventRowKey
+{
+	TArray<uint16> Building;
+	TArray<int16> CellX;
+	TArray<int16> CellY;
+
+	template <typename TFunc>
+	void ForEachColumn( TFunc&& func )
+	{
+		FSessionEventRowKey::ForEachColumn( func );
+		func( Building );
+		func( CellX );
+		func( CellY );
+	}
+};
+
+// One row per finished turn
+struct FSessionResourceColumns : FSessionEventRowKey
+{
+	TArray<uint8> Turn;
+	TArray<int32> Gold;
+	TArray<int32> Food;
+	TArray<int32> Population;
+	TArray<int32> Progress;
+
+	template <typename TFunc>
+	void ForEachColumn( TFunc&& func )
+	{
+		FSessionEventRowKey::ForEachColumn( func );
+		func( Turn );
+		func( Gold );
+		func( Food );
+		func( Population );
+		func( Progress );
+	}
+};
+
+struct FSessionPhaseColumns : FSessionEventRowKey
+{
+	TArray<uint8> OldPhase;
+	TArray<uint8> NewPhase;
+
+	template <typename TFunc>
+	void ForEachColumn( TFunc&& func )
+	{
+		FSessionEventRowKey::ForEachColumn( func );
+		func( OldPhase );
+		func( NewPhase );
+	}
+};
+
+// A whole session in memory, as produced by the reader (or the writer's pending chunk)
+struct LORDS_FRONTIERS_API FSessionEventLog
+{
+	FString MapName;
+	FString Timestamp;
+	int32 SessionSeed = 0;
+
+	// Filled from the end chunk; empty when the session was cut off
+	FString Outcome;
+	int32 WavesSurvived = 0;
+
+	TArray<FName> Names;
+
+	FSessionDamageColumns Damage;
+	FSessionDeathColumns Deaths;
+	FSessionPlacementColumns Placements;
+	FSessionResourceColumns Resources;
+	FSessionPhaseColumns Phases;
+
+	FName GetName( const uint16 index ) const
+	{
+		return Names.IsValidIndex( index ) ? Names[index] : NAME_None;
+	}
+
+	void ResetTables();
+
+	static bool LoadFromFile( const FString& path, FSessionEventLog& outLog );
+};
+
+/**
+ * Appends events to the in-memory columns and streams them to disk chunk by chunk,
+ * so a session never holds more than one chunk per table.
+ * A full chunk is handed to a worker pipe that compresses it, writes it and flushes the file; the pipe keeps
+ * chunks in submission order and is the only thing touching the file between Open and Close.
+ */
+class LORDS_FRONTIERS_API FSessionEventLogWriter
+{
+public:
+	FSessionEventLogWriter();
+	~FSessionEventLogWriter();
+
+	bool Open( const FString& path, const FString& mapName, const FString& timestamp, int32 sessionSeed );
+
+	// Flushes the pending rows and writes the end chunk
+	void Close( const FString& outcome, int32 wavesSurvived );
+
+	bool IsOpen() const
+	{
+		return File_.IsValid();
+	}
+
+	void AddDamage( float time, int32 wave, FName source, FName target, int32 amount, uint8 flags );
+	void AddDeath( float time, int32 wave, FName victim, FName killer, uint8 flags );
+	void AddPlacement( float time, int32 wave, FName building, const FIntPoint& cell );
+	void AddResources( float time, int32 wave, int32 turn, int32 gold, int32 food, int32 population, int32 progress );
+	void AddPhase( float time, int32 wave, uint8 oldPhase, uint8 newPhase );
+
+private:
+	uint16 InternName( FName name );
+
+	// Flushes the table once it holds a full chunk
+	void OnRowAdded( ESessionEventTable table, int32 rows );
+
+	void FlushTable( ESessionEventTable table );
+	void WriteNewNames();
+
+	// Runs on WritePipe_
+	void WriteTableChunk( uint8 tableId, int32 rows, const TArray<uint8>& raw );
+
+	TUniquePtr<FArchive> File_;
+	UE::Tasks::FPipe WritePipe_{ TEXT( "SessionEventLogWriter" ) };
+
+	// Pending rows, flushed per table
+	FSessionEventLog Pending_;
+
+	TMap<FName, uint16> NameIndex_;
+	int32 NamesWritten_ = 0;
+};
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <atomic>
+
+/**
+ * One damage hit as seen by FDamageEvents::OnDamageDealt. Captured with a handful of stores on the hit path;
+ * every lookup (class names, kill checks, accumulator maps) waits for the drain.
+ */
+struct FSessionDamageRecord
+{
+	TWeakObjectPtr<AActor> Instigator;
+	TWeakObjectPtr<AActor> Target;
+	const UClass* InstigatorClass = nullptr;
+	const UClass* TargetClass = nullptr;
+
+	// Game seconds since the session started
+	float Time = 0.0f;
+	int32 Amount = 0;
+	uint16 Wave = 0;
+
+	// SessionEventLog::cFlag* bits
+	uint8 Flags = 0;
+};
+
+/**
+ * Bounded single-producer / single-consumer ring of fixed-size records.
+ *
+ * Push and Drain never lock: the producer owns Head_, the consumer owns Tail_, and each publishes its index with
+ * release ordering. Push fails instead of overwriting when the ring is full, so the producer decides whether to
+ * drain early or drop.
+ */
+template <typename TRecord, uint32 TCapacity>
+class TSessionEventRing
+{
+	static_assert( TCapacity > 0 && ( TCapacity & ( TCapacity - 1 ) ) == 0, "Capacity must be a power of two" );
+
+public:
+	TSessionEventRing()
+	{
+		Records_.SetNum( TCapacity );
+	}
+
+	// Producer side
+	bool Push( const TRecord& record )
+	{
+		const uint32 head = Head_.load( std::memory_order_relaxed );
+		if ( head - Tail_.load( std::memory_order_acquire ) >= TCapacity )
+		{
+			return false;
+		}
+
+		Records_[head & ( TCapacity - 1 )] = record;
+		Head_.store( head + 1, std::memory_order_release );
+		return true;
+	}
+
+	// Consumer side: appends everything published so far to outRecords, oldest first
+	int32 Drain( TArray<TRecord>& outRecords )
+	{
+		const uint32 tail = Tail_.load( std::memory_order_relaxed );
+		const uint32 head = Head_.load( std::memory_order_acquire );
+		const int32 count = static_cast<int32>( head - tail );
+
+		outRecords.Reserve( outRecords.Num() + count );
+		for ( uint32 index = tail; index != head; ++index )
+		{
+			outRecords.Add( Records_[index & ( TCapacity - 1 )] );
+		}
+
+		Tail_.store( head, std::memory_order_release );
+		return count;
+	}
+
+	bool IsEmpty() const
+	{
+		return Head_.load( std::memory_order_acquire ) == Tail_.load( std::memory_order_acquire );
+	}
+
+private:
+	TArray<TRecord> Records_;
+	std::atomic<uint32> Head_ { 0 };
+	std::atomic<uint32> Tail_ { 0 };
+};
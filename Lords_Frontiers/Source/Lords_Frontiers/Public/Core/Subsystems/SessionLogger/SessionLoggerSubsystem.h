@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Core/Subsystems/SessionLogger/SessionEventLog.h"
+#include "Core/Subsystems/SessionLogger/SessionEventRing.h"
 #include "Core/Subsystems/SessionLogger/SessionLoggerTypes.h"
 #include "Core/GameLoop/GameLoopManager.h"
 #include "Core/GameSessionController.h"
@@ -32,12 +34,16 @@ DECLARE_MULTICAST_DELEGATE_OneParam( FOnSessionFinalized, const FLogSessionData&
  * USessionLoggerSubsystem
  *
  * World subsystem that observes game events and collects session statistics.
- * Event-driven (no Tick). Writes compressed JSON (.json.gz) to Saved/SessionLogs/ at game end.
+ * Damage hits are pushed as POD records into a ring buffer and aggregated once per frame (or right before
+ * anything reads the aggregates), so heavy waves cost a flat per-frame drain instead of map updates per hit.
+ * Everything else is event-driven. Streams raw events (damage, deaths, placements, resources, phases) to a columnar
+ * binary log (.lfslog) in SessionLogs/ while the session runs; see FSessionEventLog and the SessionLogQuery
+ * commandlet. The aggregated JSON report (.json.gz) is only written with -SessionLogJson, for debugging.
  *
  * Extensible via ISessionDataCollector interface and RegisterCollector().
  */
 UCLASS()
-class LORDS_FRONTIERS_API USessionLoggerSubsystem : public UWorldSubsystem
+class LORDS_FRONTIERS_API USessionLoggerSubsystem : public UTickableWorldSubsystem
 {
 	GENERATED_BODY()
 
@@ -45,7 +51,12 @@ public:
 	virtual void Initialize( FSubsystemCollectionBase& Collection ) override;
 	virtual void OnWorldBeginPlay( UWorld& InWorld ) override;
 	virtual void Deinitialize() override;
-	virtual bool ShouldCreateSubsystem( UObject* Outer ) const override { return true; }
+	virtual bool ShouldCreateSubsystem( UObject* outer ) const override;
+
+	virtual void Tick( float deltaTime ) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickable() const override { return bIsLogging_; }
+	virtual bool IsTickableInEditor() const override { return false; }
 
 	// Extensibility
 
@@ -58,6 +69,9 @@ public:
 
 	void FinalizeSessionOnRestart();
 
+	// Credits pending hits, then drops the per-enemy tracking; used when the battlefield is torn down in bulk
+	void ClearEnemyTracking();
+
 	FOnWaveDataFinalized OnWaveDataFinalized;
 	FOnSessionFinalized OnSessionFinalized;
 
@@ -99,12 +113,16 @@ private:
 	UFUNCTION()
 	void HandleCardsApplied( const TArray<UCardDataAsset*>& appliedCards );
 
+	// Producer side: records the hit into DamageRing_
 	void HandleDamageDealt( AActor* instigator, AActor* target, int damage, bool bIsSplash );
 
 	// Damage Sub-Handlers
 
-	void AccumulateTowerDamage( ADefensiveBuilding* tower, AActor* target, int damage, bool bIsSplash );
-	void AccumulateEnemyDamage( AUnit* enemy, AActor* target, int damage );
+	// Consumer side: aggregates the queued hits and hands the batch to collectors
+	void DrainDamageEvents();
+
+	void AccumulateTowerDamage( const FSessionDamageRecord& record );
+	void AccumulateEnemyDamage( const FSessionDamageRecord& record );
 
 	// Card Data Helpers
 
@@ -157,6 +175,12 @@ private:
 	void FinalizeWave();
 	void FinalizeSession( bool bVictory );
 
+	// Binary Event Log
+
+	void OpenEventLog();
+	void CloseEventLog();
+	float GetSessionGameSeconds() const;
+
 	// JSON Output
 
 	void WriteSessionToFile();
@@ -196,6 +220,10 @@ private:
 	// Enemy kill credit tracking: enemy -> last tower class that hit it
 	TMap<TWeakObjectPtr<AActor>, FName> EnemyLastTowerMap_;
 
+	// Hits waiting for the next drain, and the drain's reused batch buffer
+	TSessionEventRing<FSessionDamageRecord, 16384> DamageRing_;
+	TArray<FSessionDamageRecord> DamageBatch_;
+
 	// Building HP snapshot at combat start (for damage tracking)
 	TMap<TWeakObjectPtr<ABuilding>, int32> BuildingHealthAtCombatStart_;
 
@@ -203,6 +231,9 @@ private:
 	double SessionStartTime_ = 0.0;
 	double TurnStartTime_ = 0.0;
 	double CombatStartTime_ = 0.0;
+	double SessionStartGameTime_ = 0.0;
+
+	FSessionEventLogWriter EventLog_;
 
 	// Per-wave lowest base HP (for closest-call tracking)
 	int32 LowestBaseHP_ = INT32_MAX;
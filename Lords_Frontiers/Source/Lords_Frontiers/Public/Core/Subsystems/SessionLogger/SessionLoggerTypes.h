@@ -364,6 +364,10 @@ struct FLogSessionData
 
 	FString MapName;
 	FString Timestamp;
+
+	// Seed of the gameplay random streams; replaying the session with it and the same input reproduces it
+	int32 SessionSeed = 0;
+
 	bool bVictory = false;
 	int32 WavesSurvived = 0;
 
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/RandomStream.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "SessionRandomSubsystem.generated.h"
+
+// Names of the gameplay random streams. Each one is seeded from the session seed and its name only,
+// so drawing more numbers from one stream never shifts another.
+namespace RandomStreams
+{
+	inline const FName Cards( TEXT( "Cards" ) );
+	inline const FName Crits( TEXT( "Crits" ) );
+	inline const FName Attacks( TEXT( "Attacks" ) );
+	inline const FName Movement( TEXT( "Movement" ) );
+	inline const FName Spawning( TEXT( "Spawning" ) );
+	inline const FName Waves( TEXT( "Waves" ) );
+}
+
+/**
+ * One seed per session (per loaded game world), recorded in the session log.
+ * Gameplay code draws from named streams derived from it instead of the global generator,
+ * so the same seed and the same player input give the same run.
+ */
+UCLASS()
+class LORDS_FRONTIERS_API USessionRandomSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem( UObject* outer ) const override;
+	virtual void Initialize( FSubsystemCollectionBase& collection ) override;
+
+	// Stream of the world's session; a fixed-seed fallback when there is none (editor previews).
+	static FRandomStream& Stream( const UObject* worldContextObject, FName streamName );
+
+	// Seed every following session starts with until cleared with 0 (replay playback).
+	// -SessionSeed=N on the command line does the same for the whole run.
+	static void SetSessionSeedOverride( int32 seed );
+
+	int32 GetSessionSeed() const
+	{
+		return SessionSeed_;
+	}
+
+	FRandomStream& GetStream( FName streamName );
+
+private:
+	int32 SessionSeed_ = 0;
+
+	TMap<FName, FRandomStream> Streams_;
+
+	static int32 SessionSeedOverride_;
+};
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "SpawnSchedulerSubsystem.generated.h"
+
+class AUnit;
+class USpawnAbilityComponent;
+class UUnitBuilder;
+
+// Per-class spawn data of a summoned unit, read from its CDO once
+struct FSpawnedUnitClassInfo
+{
+	float CapsuleRadius = 34.f;
+	float CapsuleHalfHeight = 88.f;
+};
+
+/**
+ * Drives every USpawnAbilityComponent from one tick instead of three timers per summoner. Summoners queue their due
+ * minions here; the queue is drained at most cMaxSpawnsPerFrame per frame through one shared UUnitBuilder, so groups
+ * that come due on the same frame are spread over the following frames while the sustained spawn rate stays the same.
+ * Summoners registered together also get staggered phase offsets so their cycles do not stay aligned.
+ */
+UCLASS()
+class LORDS_FRONTIERS_API USpawnSchedulerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem( UObject* outer ) const override;
+	virtual void Initialize( FSubsystemCollectionBase& collection ) override;
+	virtual void Deinitialize() override;
+
+	virtual void Tick( float deltaTime ) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickableInEditor() const override
+	{
+		return false;
+	}
+	virtual bool IsTickable() const override
+	{
+		return Summoners_.Num() > 0 || PendingSpawns_.Num() > 0;
+	}
+
+	// Returns the phase offset (s) the summoner adds to its first group
+	float RegisterSummoner( USpawnAbilityComponent* summoner );
+
+	void UnregisterSummoner( USpawnAbilityComponent* summoner );
+
+	void EnqueueSpawn( USpawnAbilityComponent* summoner, bool bRequireTarget );
+
+	const FSpawnedUnitClassInfo& GetClassInfo( const TSubclassOf<AUnit>& unitClass );
+
+	int32 GetPendingSpawnCount() const
+	{
+		return PendingSpawns_.Num();
+	}
+
+private:
+	struct FPendingSpawn
+	{
+		TWeakObjectPtr<USpawnAbilityComponent> Summoner;
+		bool bRequireTarget = false;
+	};
+
+	void DrainSpawnQueue();
+
+	TArray<TWeakObjectPtr<USpawnAbilityComponent>> Summoners_;
+
+	// FIFO, oldest first
+	TArray<FPendingSpawn> PendingSpawns_;
+
+	TMap<TObjectKey<UClass>, FSpawnedUnitClassInfo> ClassInfo_;
+
+	UPROPERTY()
+	TObjectPtr<UUnitBuilder> UnitBuilder_;
+
+	// Low-discrepancy sequence in [0, 1) used for phase offsets
+	float PhaseSequence_ = 0.f;
+};
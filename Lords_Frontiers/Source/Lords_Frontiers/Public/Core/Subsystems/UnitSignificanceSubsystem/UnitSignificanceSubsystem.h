@@ -0,0 +1,65 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "UnitSignificanceSubsystem.generated.h"
+
+class AUnit;
+struct FCameraViewState;
+
+// Update-rate tier of a unit, from full rate to barely ticking.
+enum class EUnitLodTier : uint8
+{
+	Near,
+	Mid,
+	Far
+};
+
+/**
+ * Ranks registered units by projected screen size from the strategy camera every few frames
+ * and hands each one a LOD tier (see AUnit::ApplyLodTier). Tiers are applied only when they change.
+ */
+UCLASS()
+class LORDS_FRONTIERS_API UUnitSignificanceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Tick( float deltaTime ) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickableInEditor() const override
+	{
+		return false;
+	}
+	virtual bool IsTickable() const override
+	{
+		return Units_.Num() > 0;
+	}
+
+	void RegisterUnit( AUnit* unit );
+
+	void UnregisterUnit( AUnit* unit );
+
+	// Drops every destroyed unit in one compaction pass (used after a bulk teardown).
+	void RemoveStaleUnits();
+
+	int32 GetUnitCount() const
+	{
+		return Units_.Num();
+	}
+
+private:
+	EUnitLodTier ComputeTier( const AUnit& unit, const FCameraViewState& viewState ) const;
+
+	void RemoveAt( int32 index );
+
+	// Structure of arrays, same index across all of them.
+	TArray<TWeakObjectPtr<AUnit>> Units_;
+	TArray<TObjectKey<AUnit>> Keys_;
+	TArray<EUnitLodTier> Tiers_;
+
+	TMap<TObjectKey<AUnit>, int32> IndexByUnit_;
+
+	uint32 FramesUntilUpdate_ = 0;
+};
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "VFXPoolSubsystem.generated.h"
+
+class UEntityVFXConfig;
+class UNiagaraComponent;
+class UNiagaraSystem;
+
+/**
+ * Spawns fire-and-forget effects (spawn, hit, death, impacts) through the engine Niagara component pool
+ * (ENCPoolMethod::AutoRelease); how many free components a system keeps is its MaxPoolSize.
+ * On top of the pool, effects that would start off screen or too small to see are skipped, and each system is capped
+ * at MaxActivePerSystem_ concurrent instances.
+ */
+UCLASS()
+class LORDS_FRONTIERS_API UVFXPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// Returns the playing component, or nullptr if the effect was culled or capped.
+	// The component goes back to the pool when the effect finishes, so it must not be kept.
+	// bCullable = false for effects that matter even when they start off screen (e.g. long building effects)
+	UNiagaraComponent* SpawnAtLocation(
+	    UNiagaraSystem* system, const FVector& location, const FRotator& rotation = FRotator::ZeroRotator,
+	    const FVector& scale = FVector( 1.0f ), bool bCullable = true
+	);
+
+	// Puts count inactive components of the system into the engine pool
+	void PreWarm( UNiagaraSystem* system, int32 count );
+
+	// Warms every system referenced by the config with its warmup count and applies its caps
+	void PreWarmFromConfig( const UEntityVFXConfig& config );
+
+	int32 GetActiveCount( const UNiagaraSystem* system ) const;
+
+	int32 GetTotalActiveCount() const
+	{
+		return TotalActive_;
+	}
+
+	int32 GetCulledCount() const
+	{
+		return CulledCount_;
+	}
+
+private:
+	bool IsWorthSpawning( const FVector& location ) const;
+
+	UFUNCTION()
+	void HandleSystemFinished( UNiagaraComponent* component );
+
+	UPROPERTY()
+	TMap<TObjectPtr<UNiagaraSystem>, int32> ActiveCounts_;
+
+	int32 MaxActivePerSystem_ = 24;
+
+	// Assumed on-screen radius of an effect for culling, in world units
+	float CullRadius_ = 300.0f;
+
+	int32 TotalActive_ = 0;
+	int32 CulledCount_ = 0;
+};
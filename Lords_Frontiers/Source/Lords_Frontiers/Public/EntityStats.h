@@ -1,5 +1,7 @@
 #pragma once
 
+#include "StatModifierStack.h"
+
 #include "CoreMinimal.h"
 
 #include "EntityStats.generated.h"
@@ -23,7 +25,11 @@ enum class EStatsType : uint8
 	MaxSpeed,
 	SplashRadius,
 	BurstCount,
-	BurstDelay
+	BurstDelay,
+	CritChance,
+	CritDamageBonus,
+
+	Count UMETA( Hidden )
 };
 
 UENUM( BlueprintType )
@@ -113,6 +119,40 @@ struct FEntityStats
 
 	void AddBurstDelay( float burstDelay );
 
+	// compiled stat access, replaces FindPropertyByName lookups on hot paths
+	// maps a CardModifiable property name (e.g. "AttackDamage_") to its stat
+	static bool FindStat( FName propertyName, EStatsType& outStat );
+
+	static FName GetStatPropertyName( EStatsType statType );
+
+	double GetStatValue( EStatsType statType ) const;
+
+	void SetStatValue( EStatsType statType, double value );
+
+	// modifier stack
+	// A stat with modifiers is recomputed from its unmodified base whenever the stack changes,
+	// so removing a source is exact no matter how many others were added or removed meanwhile.
+	// Setting a zero additive value removes the modifier.
+	void SetModifier(
+	    EStatsType statType, const FStatModifierSource& source, float value,
+	    EStatModifierLayer layer = EStatModifierLayer::Additive
+	);
+
+	void RemoveModifier( EStatsType statType, const FStatModifierSource& source );
+
+	// Counted variant of SetModifier: every push must be matched by a pop.
+	void PushModifier(
+	    EStatsType statType, const FStatModifierSource& source, float value,
+	    EStatModifierLayer layer = EStatModifierLayer::Additive
+	);
+
+	void PopModifier( EStatsType statType, const FStatModifierSource& source );
+
+	// Defers recomputation of changed stats until the matching EndModifierBatch.
+	void BeginModifierBatch();
+
+	void EndModifierBatch();
+
 	// returns applied damage
 	int ApplyDamage( int damage );
 
@@ -177,4 +217,16 @@ private:
 	ETeam Team_;
 
 	float LastAttackGameTime_ = -999.0f;
+
+	void MarkStatDirty( EStatsType statType );
+
+	void ResolveStat( EStatsType statType );
+
+	FStatModifierLayers& FindOrAddLayers( EStatsType statType );
+
+	TMap<EStatsType, FStatModifierLayers> ModifierLayers_;
+
+	uint32 DirtyStats_ = 0;
+
+	int32 ModifierBatchDepth_ = 0;
 };
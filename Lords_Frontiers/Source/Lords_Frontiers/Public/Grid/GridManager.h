@@ -1,10 +1,13 @@
 ﻿#pragma once
 
+#include "Building/Bonus/BuildingBonusEntry.h"
 #include "GridCell.h"
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 
+#include <type_traits>
+
 #include "GridManager.generated.h"
 
 /// @brief Single row of the 2D grid.
@@ -106,15 +109,138 @@ public:
 	/// @brief Find the closest cell with bWalkable = true
 	FIntPoint FindClosestWalkableCellCoords( FVector location ) const;
 
-	/// @brief Get array the cell's neighbors
-	/// @param[in] FGridCell 
-	/// @param[in] radius how many cells to look at.
-	/// @return Array of cells TArray<FGridCell*>
-	/// 
+	/// @brief Visit valid cells of a bonus shape around a center cell (center excluded) without allocating.
+	/// Cross visits rings outward as +X, -X, +Y, -Y; Square visits row by row.
+	/// @param[in] center Center cell.
+	/// @param[in] radius How many cells to look at.
+	/// @param[in] visitor Callable taking (FGridCell& cell). May return bool; false stops the iteration.
+	/// @return false if the visitor stopped the iteration early.
+	template <EBonusShape Shape, typename VisitorType>
+	bool ForEachCellInShape( const FIntPoint& center, const int32 radius, VisitorType&& visitor )
+	{
+		if constexpr ( Shape == EBonusShape::Square )
+		{
+			for ( int32 dy = -radius; dy <= radius; ++dy )
+			{
+				for ( int32 dx = -radius; dx <= radius; ++dx )
+				{
+					if ( ( dx != 0 || dy != 0 ) && !VisitCell( center.X + dx, center.Y + dy, visitor ) )
+					{
+						return false;
+					}
+				}
+			}
+		}
+		else
+		{
+			for ( int32 i = 1; i <= radius; ++i )
+			{
+				if ( !VisitCell( center.X + i, center.Y, visitor ) || !VisitCell( center.X - i, center.Y, visitor ) ||
+				     !VisitCell( center.X, center.Y + i, visitor ) || !VisitCell( center.X, center.Y - i, visitor ) )
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	/// @brief Runtime-shape overload; dispatches to the compile-time specialization.
+	template <typename VisitorType>
+	bool ForEachCellInShape(
+	    const FIntPoint& center, const int32 radius, const EBonusShape shape, VisitorType&& visitor
+	)
+	{
+		switch ( shape )
+		{
+		case EBonusShape::Square:
+			return ForEachCellInShape<EBonusShape::Square>( center, radius, Forward<VisitorType>( visitor ) );
+		case EBonusShape::Cross:
+		default:
+			return ForEachCellInShape<EBonusShape::Cross>( center, radius, Forward<VisitorType>( visitor ) );
+		}
+	}
+
+	// === Runtime mirror (hot paths) ===
+	// GridRows_ stays the source of truth. The mirror below is rebuilt in InitializeGrid and kept in sync by
+	// the Set* mutators, so runtime code must change cell state only through them.
+
+	/// @brief Check coords against the runtime mirror. Does not log.
+	FORCEINLINE bool IsValidCoordsFast( const int32 x, const int32 y ) const
+	{
+		return static_cast<uint32>( x ) < static_cast<uint32>( RuntimeStride_ ) &&
+		       static_cast<uint32>( y ) < static_cast<uint32>( RuntimeHeight_ ) && ValidBits_[y * RuntimeStride_ + x];
+	}
+
+	/// @brief Walkable flag of the cell, false for out-of-bounds coords.
+	FORCEINLINE bool IsWalkableFast( const int32 x, const int32 y ) const
+	{
+		return IsValidCoordsFast( x, y ) && WalkableBits_[y * RuntimeStride_ + x];
+	}
+
+	/// @brief Buildable flag of the cell, false for out-of-bounds coords.
+	FORCEINLINE bool IsBuildableFast( const int32 x, const int32 y ) const
+	{
+		return IsValidCoordsFast( x, y ) && BuildableBits_[y * RuntimeStride_ + x];
+	}
+
+	/// @brief Occupied flag of the cell, false for out-of-bounds coords.
+	FORCEINLINE bool IsOccupiedFast( const int32 x, const int32 y ) const
+	{
+		return IsValidCoordsFast( x, y ) && OccupiedBits_[y * RuntimeStride_ + x];
+	}
+
+	/// @brief Occupant of the cell or nullptr (out of bounds, empty or destroyed).
+	FORCEINLINE ABuilding* GetOccupantFast( const int32 x, const int32 y ) const
+	{
+		return IsValidCoordsFast( x, y ) ? Occupants_[y * RuntimeStride_ + x].Get() : nullptr;
+	}
 
-	TArray<FGridCell*> GetCellsInCross( const FIntPoint& myCell, int32 radius );
-	TArray<FGridCell*> GetCellsInSquare( const FIntPoint& myCell, int32 radius );
-	TArray<FGridCell*> GetCellsByShape( const FIntPoint& myCell, int32 radius, EBonusShape shape );
+	/// @brief Same as GetCell but without logging; use where out-of-bounds probes are expected.
+	FORCEINLINE FGridCell* GetCellFast( const int32 x, const int32 y )
+	{
+		return IsValidCoordsFast( x, y ) ? DenseCells_[y * RuntimeStride_ + x] : nullptr;
+	}
+
+	FORCEINLINE const FGridCell* GetCellFast( const int32 x, const int32 y ) const
+	{
+		return IsValidCoordsFast( x, y ) ? DenseCells_[y * RuntimeStride_ + x] : nullptr;
+	}
+
+	/// @brief Flat index of a cell in the runtime mirror, INDEX_NONE if the cell does not exist.
+	FORCEINLINE int32 GetRuntimeCellIndex( const FIntPoint& coords ) const
+	{
+		return IsValidCoordsFast( coords.X, coords.Y ) ? coords.Y * RuntimeStride_ + coords.X : INDEX_NONE;
+	}
+
+	/// @brief Visit valid neighbors of a cell without allocating.
+	/// @param[in] coords Center cell.
+	/// @param[in] bDiagonals Visit 8 neighbors instead of 4.
+	/// @param[in] visitor Callable taking (const FIntPoint& neighborCoords).
+	template <typename VisitorType>
+	void ForEachNeighbor( const FIntPoint& coords, const bool bDiagonals, VisitorType&& visitor ) const
+	{
+		static constexpr int32 offsets[8][2] = { { 1, 0 }, { -1, 0 }, { 0, 1 },  { 0, -1 },
+		                                         { 1, 1 }, { 1, -1 }, { -1, 1 }, { -1, -1 } };
+		const int32 count = bDiagonals ? 8 : 4;
+		for ( int32 i = 0; i < count; ++i )
+		{
+			const FIntPoint next( coords.X + offsets[i][0], coords.Y + offsets[i][1] );
+			if ( IsValidCoordsFast( next.X, next.Y ) )
+			{
+				visitor( next );
+			}
+		}
+	}
+
+	/// @brief Set or clear the building on a cell. Updates bIsOccupied accordingly.
+	void SetCellOccupant( const FIntPoint& coords, ABuilding* occupant );
+
+	/// @brief Clear the cell only if it is occupied by the given building.
+	void ClearCellOccupant( const FIntPoint& coords, const ABuilding* expectedOccupant );
+
+	void SetCellWalkable( const FIntPoint& coords, bool bWalkable );
+	void SetCellBuildable( const FIntPoint& coords, bool bBuildable );
 
 protected:
 	/// @brief Called when the game starts or when spawned.
@@ -143,7 +269,56 @@ private:
 	/// - resets runtime state of empty cells.
 	void InitializeGrid();
 
+	/// @brief Rebuild dense cell pointers, flag bitsets and occupant handles from GridRows_.
+	void RebuildRuntimeMirror();
+
+	/// @brief Copy flags of one cell from GridRows_ into the mirror.
+	void SyncRuntimeCell( const int32 x, const int32 y );
+
+	/// @brief Cell lookup for shape visitors: uses the mirror once built, GridRows_ before BeginPlay.
+	FORCEINLINE FGridCell* FindCellForVisit( const int32 x, const int32 y )
+	{
+		if ( RuntimeStride_ > 0 )
+		{
+			return GetCellFast( x, y );
+		}
+		return IsValidCoords( x, y ) ? &GridRows_[y].Cells[x] : nullptr;
+	}
+
+	/// @brief Invoke a shape visitor on one cell. Returns false if the visitor asked to stop.
+	template <typename VisitorType>
+	FORCEINLINE bool VisitCell( const int32 x, const int32 y, VisitorType& visitor )
+	{
+		FGridCell* cell = FindCellForVisit( x, y );
+		if ( !cell )
+		{
+			return true;
+		}
+		if constexpr ( std::is_same_v<decltype( visitor( *cell ) ), bool> )
+		{
+			return visitor( *cell );
+		}
+		else
+		{
+			visitor( *cell );
+			return true;
+		}
+	}
+
 	/// @brief Calculate grid coords based on location.
 	/// Returns coords as if grid is infinite
 	FIntPoint GetCellCoordsRaw( FVector location ) const;
+
+	// Mirror dimensions: stride is the widest row, cells past a shorter row's end are marked invalid.
+	int32 RuntimeStride_ = 0;
+	int32 RuntimeHeight_ = 0;
+
+	// Indexed by y * RuntimeStride_ + x. Pointers target GridRows_ elements; rows are not resized at runtime.
+	TArray<FGridCell*> DenseCells_;
+	TArray<TWeakObjectPtr<ABuilding>> Occupants_;
+
+	TBitArray<> ValidBits_;
+	TBitArray<> WalkableBits_;
+	TBitArray<> BuildableBits_;
+	TBitArray<> OccupiedBits_;
 };
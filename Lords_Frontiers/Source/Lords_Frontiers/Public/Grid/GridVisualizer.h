@@ -37,6 +37,8 @@ public:
 	UFUNCTION( BlueprintCallable, Category = "Settings|Grid" )
 	bool GetCellWorldCenter( const FIntPoint& cellCoords, FVector& outLocation ) const;
 
+	// The highlight has its own instanced component, visible regardless of the grid. Only cells entering or
+	// leaving the set are written; freed instances are parked at zero scale and reused.
 	void ShowBonusHighlight( const TArray<FIntPoint>& cells, UMaterialInterface* material );
 	void HideBonusHighlight();
 
@@ -64,5 +66,32 @@ protected:
 	TObjectPtr<UInstancedStaticMeshComponent> BonusHighlightMesh_;
 
 private:
+	// Builds instances once, afterwards only writes transforms of cells whose state changed.
 	void RefreshGrid();
+
+	void BuildInstances();
+
+	// Writes transforms of one cell into both components. Returns true if anything changed.
+	bool SyncCellInstance( int32 denseIndex, const FIntPoint& coords );
+
+	FTransform MakeCellTransform( const FIntPoint& coords, bool bVisible ) const;
+
+	FTransform MakeHighlightTransform( const FIntPoint& coords, bool bVisible ) const;
+
+	int32 DenseIndex( const FIntPoint& coords ) const
+	{
+		return coords.Y * LayoutStride_ + coords.X;
+	}
+
+	// Every valid cell owns one instance in both components under the same index; the component that does not
+	// match the cell's buildable state keeps it at zero scale, so flag changes never reorder instances.
+	TArray<int32> CellToInstance_;
+	TBitArray<> CachedBuildable_;
+
+	TMap<FIntPoint, int32> HighlightInstanceByCell_;
+	TArray<int32> FreeHighlightInstances_;
+
+	int32 LayoutStride_ = 0;
+	int32 LayoutHeight_ = 0;
+	bool bInstancesBuilt_ = false;
 };
@@ -32,6 +32,16 @@ public:
 	void BeginDeactivation();
 	void FinalizeDeactivation();
 
+	bool IsInFlight() const
+	{
+		return bIsActive_;
+	}
+
+	bool IsPendingReturn() const
+	{
+		return bIsPendingReturn_;
+	}
+
 	virtual void Tick( float deltaTime ) override;
 
 	bool Initialize(
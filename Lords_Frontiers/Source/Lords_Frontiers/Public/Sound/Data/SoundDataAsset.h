@@ -33,6 +33,28 @@ struct FSoundEntry
 	    meta = ( UIMin = "0.0", UIMax = "1.0", ClampMin = "0.0", ClampMax = "1.0" )
 	)
 	FVector2D VolumeRange = FVector2D( 1.f, 1.f );
+
+	// Higher priority voices steal lower ones when the voice budget is full
+	UPROPERTY( EditDefaultsOnly, BlueprintReadOnly, Category = "Budget", meta = ( ClampMin = "0.0" ) )
+	float Priority = 1.f;
+
+	// Max voices of this tag playing at once; 0 uses the asset default
+	UPROPERTY( EditDefaultsOnly, BlueprintReadOnly, Category = "Budget", meta = ( ClampMin = "0" ) )
+	int32 MaxConcurrent = 0;
+
+	// Events of this tag closer than CoalesceRadius within CoalesceWindow merge into one louder voice
+	UPROPERTY( EditDefaultsOnly, BlueprintReadOnly, Category = "Budget", meta = ( ClampMin = "0.0", Units = "s" ) )
+	float CoalesceWindow = 0.05f;
+
+	UPROPERTY( EditDefaultsOnly, BlueprintReadOnly, Category = "Budget", meta = ( ClampMin = "0.0", Units = "cm" ) )
+	float CoalesceRadius = 600.f;
+
+	// Volume added per merged event, relative to the first one, capped by MaxCoalescedVolume
+	UPROPERTY( EditDefaultsOnly, BlueprintReadOnly, Category = "Budget", meta = ( ClampMin = "0.0" ) )
+	float CoalesceVolumeStep = 0.15f;
+
+	UPROPERTY( EditDefaultsOnly, BlueprintReadOnly, Category = "Budget", meta = ( ClampMin = "1.0" ) )
+	float MaxCoalescedVolume = 2.f;
 };
 
 UCLASS( BlueprintType )
@@ -43,7 +65,24 @@ class LORDS_FRONTIERS_API USoundDataAsset : public UDataAsset
 public:
 	const FSoundEntry* FindByTag( const FGameplayTag& tag );
 
+	int32 MaxVoices() const
+	{
+		return MaxVoices_;
+	}
+
+	int32 DefaultMaxConcurrent() const
+	{
+		return DefaultMaxConcurrent_;
+	}
+
 private:
+	// Upper bound of pooled 3D voices; past it the least important voice (priority, distance) is stolen
+	UPROPERTY( EditDefaultsOnly, Category = "Settings|Budget", meta = ( ClampMin = "1" ) )
+	int32 MaxVoices_ = 32;
+
+	UPROPERTY( EditDefaultsOnly, Category = "Settings|Budget", meta = ( ClampMin = "1" ) )
+	int32 DefaultMaxConcurrent_ = 6;
+
 	UPROPERTY( EditDefaultsOnly, Category = "Settings" )
 	TMap<FGameplayTag, FSoundEntry> Entries_;
 };
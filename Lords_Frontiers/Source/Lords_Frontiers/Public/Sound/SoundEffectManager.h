@@ -13,6 +13,18 @@ class USoundDataAsset;
 class UAudioComponent;
 class USoundAttenuation;
 
+struct FSoundVoiceState
+{
+	FGameplayTag Tag;
+	FVector Location = FVector::ZeroVector;
+	float Priority = 0.f;
+	float BaseVolume = 1.f;
+	float MaxCoalescedVolume = 1.f;
+	double StartTime = 0.0;
+	int32 MergedCount = 0;
+	bool bActive = false;
+};
+
 /** (Gregory-hub) */
 UCLASS()
 class LORDS_FRONTIERS_API USoundEffectManager : public UGameInstanceSubsystem
@@ -31,23 +43,55 @@ private:
 	UFUNCTION()
 	void HandleAudioEvent( FAudioEvent event );
 
-	TWeakObjectPtr<UAudioComponent> AcquireAudioComponent();
-	void ReleaseAudioComponent( TWeakObjectPtr<UAudioComponent> component );
+	void HandleWorldCleanup( UWorld* world, bool bSessionEnded, bool bCleanupResources );
+
+	// Stops every pooled voice and forgets per-tag counts and 2D timestamps
+	void ResetVoices();
+
+	// Returns a voice index for a new 3D sound, or INDEX_NONE if the sound is not worth a voice
+	int32 AcquireVoice( const FSoundEntry& entry, const FGameplayTag& tag, const FVector& worldLocation );
+
+	// Voice of the same tag close enough in time and space to absorb a new event
+	int32 FindCoalescingVoice( const FSoundEntry& entry, const FGameplayTag& tag, const FVector& worldLocation ) const;
+
+	// Least important active voice (optionally only of one tag) and its score
+	int32 FindVoiceToSteal( const FGameplayTag* tagFilter, float& outScore ) const;
+
+	float VoiceScore( float priority, const FVector& location ) const;
+
+	UAudioComponent* CreateVoiceComponent( int32 voiceIndex );
 
-	void OnSoundFinished( TWeakObjectPtr<UAudioComponent> component );
+	void StopVoice( int32 voiceIndex );
+
+	void OnVoiceFinished( int32 voiceIndex, UAudioComponent* component );
 
 	void Play2D( const FSoundEntry& entry, const FGameplayTag& tag );
 	void Play3D( const FSoundEntry& entry, const FGameplayTag& tag, const FVector& worldLocation );
 
+	double CurrentTime() const;
+
 	UPROPERTY()
 	TObjectPtr<USoundDataAsset> SoundData_;
 
 	UPROPERTY()
 	TObjectPtr<USoundAttenuation> DefaultAttenuation_;
 
+	// Bounded voice pool; VoiceStates_ is parallel to Voices_
 	UPROPERTY()
-	TSet<TObjectPtr<UAudioComponent>> FreeComponentsPool_;
+	TArray<TObjectPtr<UAudioComponent>> Voices_;
 
-	UPROPERTY()
-	TSet<TObjectPtr<UAudioComponent>> ComponentsInUsePool_;
+	TArray<FSoundVoiceState> VoiceStates_;
+
+	TMap<FGameplayTag, int32> ActiveVoicesByTag_;
+
+	// Round-robin start point for the free voice search
+	int32 NextVoice_ = 0;
+
+	// 2D sounds are not pooled; only one per tag is started inside its coalesce window
+	TMap<FGameplayTag, double> Last2DPlayTime_;
+
+	// Listener position, refreshed once per audio event
+	FVector ListenerLocation_ = FVector::ZeroVector;
+
+	FDelegateHandle WorldCleanupHandle_;
 };
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+enum class EStatModifierLayer : uint8
+{
+	// Added to the base value
+	Additive,
+	// Multiplies base + additive (1.1 = +10%)
+	Multiplicative,
+	// Replaces the result; the largest override wins
+	Override
+};
+
+// Who contributed a modifier. Slot tells apart several contributions of one object (event index, bonus entry...)
+struct LORDS_FRONTIERS_API FStatModifierSource
+{
+	FStatModifierSource() = default;
+
+	explicit FStatModifierSource( const UObject* object, const int32 slot = 0 ) : Object( object ), Slot( slot )
+	{
+	}
+
+	bool operator==( const FStatModifierSource& other ) const
+	{
+		return Object == other.Object && Slot == other.Slot;
+	}
+
+	friend uint32 GetTypeHash( const FStatModifierSource& source )
+	{
+		return HashCombineFast( GetTypeHash( source.Object ), ::GetTypeHash( source.Slot ) );
+	}
+
+	FObjectKey Object;
+	int32 Slot = 0;
+};
+
+struct FStatModifier
+{
+	EStatModifierLayer Layer = EStatModifierLayer::Additive;
+	double Value = 0.0;
+	// Pushes of the same value by one source (a building bonus granted by several neighbours)
+	int32 Count = 1;
+};
+
+// Modifiers of one stat and the unmodified value they are applied on
+struct LORDS_FRONTIERS_API FStatModifierLayers
+{
+	double Evaluate() const;
+
+	TMap<FStatModifierSource, FStatModifier> Modifiers;
+
+	double Base = 0.0;
+
+	// Value last written to the stat; anything else found there was written directly and moves the base
+	double Applied = 0.0;
+};
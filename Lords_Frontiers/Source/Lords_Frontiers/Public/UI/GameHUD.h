@@ -214,7 +214,9 @@ public:
 
 	UPROPERTY()
 	TArray<TObjectPtr<UBonusIconWidget>> ActiveBonusIcons_;
-	TArray<FVector> ActiveBonusWorldPositions_;
+
+	// Zoom generation bonus icons were last scaled for (positions are driven by UScreenAnchorSubsystem).
+	uint64 BonusIconZoomGeneration_ = 0;
 
 	UFUNCTION( BlueprintCallable, Category = "UI|WaveInfo" )
 	void ToggleWaveInfoPanel();
@@ -37,4 +37,14 @@ public:
 
 	UPROPERTY( EditAnywhere, BlueprintReadOnly, Category = "Settings|HealthBar|Placement" )
 	FVector2D WorldDrawSize_ = FVector2D( 150.0f, 20.0f );
+
+	// Bars of entities outside the camera frustum give their widget back to the pool.
+	UPROPERTY( EditAnywhere, BlueprintReadOnly, Category = "Settings|HealthBar|LOD" )
+	bool bCullOffscreen_ = true;
+
+	// Entities whose projected size is below this (px) are treated as off-screen; 0 disables.
+	UPROPERTY(
+	    EditAnywhere, BlueprintReadOnly, Category = "Settings|HealthBar|LOD", meta = ( ClampMin = "0" )
+	)
+	float MinOnScreenSize_ = 4.0f;
 };
@@ -13,6 +13,7 @@
 #include "Components/Attack/AttackComponent.h"
 #include "Components/Attack/UnitAttackRangedComponent.h"
 #include "Components/EnemyAggressionComponent.h"
+#include "Components/SkinnedMeshComponent.h"
 #include "CoreMinimal.h"
 #include "GameFramework/Pawn.h"
 
@@ -28,6 +29,7 @@ class UFollowComponent;
 class UNiagaraSystem;
 class UHealthBarConfigDataAsset;
 struct FEnemyBuff;
+enum class EUnitLodTier : uint8;
 
 USTRUCT(BlueprintType)
 struct FUnitAudioTags
@@ -202,6 +204,9 @@ public:
 		return false;
 	}
 
+	// Sets actor (animation selection) and skeletal mesh tick rates for a significance tier; movement keeps full rate
+	void ApplyLodTier( EUnitLodTier tier );
+
 	bool PlayAnimationIdle();
 	bool PlayAnimationAttack();
 	bool PlayAnimationSpawnAbility();
@@ -326,5 +331,9 @@ protected:
 
 	bool bIdleIsAnimated_ = false;
 
+	// Authored anim tick option, restored when leaving the far LOD tier
+	EVisibilityBasedAnimTickOption DefaultAnimTickOption_ =
+	    EVisibilityBasedAnimTickOption::AlwaysTickPoseAndRefreshBones;
+
 	bool bPlayingIdleAnimation = false;
 };
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+
+/**
+ * Gameplay profiling: `stat LordsFrontiers` in game, the LordsFrontiers trace channel in Insights
+ * (-trace=cpu,LordsFrontiers), and the per-wave report written by UPerfReportSubsystem.
+ *
+ * Wrap a hot path in LF_SCOPE_CYCLE_COUNTER( <EGameplayPerfSystem name> ) to feed all three.
+ */
+
+DECLARE_STATS_GROUP( TEXT( "Lords Frontiers" ), STATGROUP_LordsFrontiers, STATCAT_Advanced );
+
+DECLARE_CYCLE_STAT_EXTERN(
+    TEXT( "Pathfinding" ), STAT_LF_Pathfinding, STATGROUP_LordsFrontiers, LORDS_FRONTIERS_API
+);
+DECLARE_CYCLE_STAT_EXTERN(
+    TEXT( "Target Search" ), STAT_LF_TargetSearch, STATGROUP_LordsFrontiers, LORDS_FRONTIERS_API
+);
+DECLARE_CYCLE_STAT_EXTERN(
+    TEXT( "Deal Damage" ), STAT_LF_DealDamage, STATGROUP_LordsFrontiers, LORDS_FRONTIERS_API
+);
+DECLARE_CYCLE_STAT_EXTERN(
+    TEXT( "Card Dispatch" ), STAT_LF_CardDispatch, STATGROUP_LordsFrontiers, LORDS_FRONTIERS_API
+);
+DECLARE_CYCLE_STAT_EXTERN(
+    TEXT( "Bonus Recalc" ), STAT_LF_BonusRecalc, STATGROUP_LordsFrontiers, LORDS_FRONTIERS_API
+);
+DECLARE_CYCLE_STAT_EXTERN(
+    TEXT( "Spawn Enemy" ), STAT_LF_SpawnEnemy, STATGROUP_LordsFrontiers, LORDS_FRONTIERS_API
+);
+DECLARE_CYCLE_STAT_EXTERN(
+    TEXT( "Status Effects" ), STAT_LF_StatusEffects, STATGROUP_LordsFrontiers, LORDS_FRONTIERS_API
+);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(
+    TEXT( "Active Units" ), STAT_LF_ActiveUnits, STATGROUP_LordsFrontiers, LORDS_FRONTIERS_API
+);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(
+    TEXT( "Active Projectiles" ), STAT_LF_ActiveProjectiles, STATGROUP_LordsFrontiers, LORDS_FRONTIERS_API
+);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(
+    TEXT( "Path Computations" ), STAT_LF_PathComputations, STATGROUP_LordsFrontiers, LORDS_FRONTIERS_API
+);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(
+    TEXT( "Active Status Effects" ), STAT_LF_ActiveStatusEffects, STATGROUP_LordsFrontiers, LORDS_FRONTIERS_API
+);
+
+UE_TRACE_CHANNEL_EXTERN( LordsFrontiersChannel, LORDS_FRONTIERS_API );
+
+enum class EGameplayPerfSystem : uint8
+{
+	Pathfinding,
+	TargetSearch,
+	DealDamage,
+	CardDispatch,
+	BonusRecalc,
+	SpawnEnemy,
+	StatusEffects,
+	Count
+};
+
+/**
+ * Always-on frame accumulators behind the per-wave report. Stats are compiled out of shipping builds and only
+ * collected while `stat` is active, so the report keeps its own cycle totals; each scope costs two Cycles64 reads
+ * and one relaxed atomic add.
+ */
+struct LORDS_FRONTIERS_API FGameplayPerf
+{
+	static constexpr int32 cSystemCount = static_cast<int32>( EGameplayPerfSystem::Count );
+
+	static void AddCycles( EGameplayPerfSystem system, uint64 cycles );
+
+	// Copies this frame's cycles per system into outCycles and starts a new frame
+	static void ConsumeFrame( uint64 ( &outCycles )[cSystemCount] );
+
+	static void AdjustStatusEffects( int32 delta );
+	static int32 GetActiveStatusEffects();
+
+	static void CountPathComputation();
+	static int32 ConsumePathComputations();
+
+	static const TCHAR* GetSystemName( EGameplayPerfSystem system );
+};
+
+class FGameplayPerfScope
+{
+public:
+	explicit FGameplayPerfScope( const EGameplayPerfSystem system )
+	    : System_( system ), StartCycles_( FPlatformTime::Cycles64() )
+	{
+	}
+
+	~FGameplayPerfScope()
+	{
+		FGameplayPerf::AddCycles( System_, FPlatformTime::Cycles64() - StartCycles_ );
+	}
+
+private:
+	EGameplayPerfSystem System_;
+	uint64 StartCycles_;
+};
+
+#define LF_SCOPE_CYCLE_COUNTER( System )                                                                               \
+	SCOPE_CYCLE_COUNTER( STAT_LF_##System );                                                                           \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL( LF_##System, LordsFrontiersChannel );                                    \
+	FGameplayPerfScope PREPROCESSOR_JOIN( GameplayPerfScope_, __LINE__ )( EGameplayPerfSystem::System )
@@ -119,4 +119,20 @@ public:
 
 	UPROPERTY( EditAnywhere, BlueprintReadOnly, Category = "Projectile|Overrides" )
 	TMap<EProjectileType, FProjectileImpactVFX> ProjectileVFXOverrides;
+
+	// Components put into the Niagara pool up front for each unit, hit and impact system above
+	UPROPERTY( EditAnywhere, BlueprintReadOnly, Category = "Pool", meta = ( ClampMin = "0" ) )
+	int32 VFXPoolWarmupCount = 4;
+
+	// Per-system warmup replacing VFXPoolWarmupCount; the pool keeps at most the system's MaxPoolSize free
+	UPROPERTY( EditAnywhere, BlueprintReadOnly, Category = "Pool" )
+	TMap<TObjectPtr<UNiagaraSystem>, int32> VFXPoolWarmupOverrides;
+
+	// Concurrent instances per system; further spawns are dropped. 0 = unlimited
+	UPROPERTY( EditAnywhere, BlueprintReadOnly, Category = "Pool", meta = ( ClampMin = "0" ) )
+	int32 VFXMaxActivePerSystem = 24;
+
+	// Effects whose sphere of this radius is off screen or under a few pixels are not spawned
+	UPROPERTY( EditAnywhere, BlueprintReadOnly, Category = "Pool", meta = ( ClampMin = "0.0", Units = "cm" ) )
+	float VFXCullRadius = 300.0f;
 };
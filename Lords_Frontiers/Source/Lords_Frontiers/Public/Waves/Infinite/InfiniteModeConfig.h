@@ -157,4 +157,10 @@ public:
 
 	UPROPERTY( EditAnywhere, BlueprintReadOnly, Category = "Спецправила", meta = ( ClampMin = "0", DisplayName = "Перерыв между Apex (волн)", ToolTip = "Минимум сколько волн между двумя появлениями присетов с тегом Apex (сильнейший босс)." ) )
 	int32 ApexCooldownWaves = 8;
+
+	UPROPERTY( EditAnywhere, BlueprintReadOnly, Category = "Производительность", meta = ( ClampMin = "0", ClampMax = "16", DisplayName = "Волн наперёд", ToolTip = "Сколько следующих волн просчитывать заранее в фоне во время фазы строительства. 0 = строить волну в момент старта." ) )
+	int32 LookAheadWaves = 3;
+
+	UPROPERTY( EditAnywhere, BlueprintReadOnly, Category = "Производительность", meta = ( ClampMin = "0", DisplayName = "Прогрев снарядов на класс врага", ToolTip = "Сколько снарядов положить в пул для каждого стреляющего класса врага из просчитанных волн." ) )
+	int32 ProjectileWarmupPerEnemyClass = 8;
 };
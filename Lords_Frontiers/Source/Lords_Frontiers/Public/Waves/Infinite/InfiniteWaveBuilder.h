@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Async/Future.h"
 #include "UObject/Object.h"
 
 #include "Lords_Frontiers/Public/Waves/EnemyBuff.h"
@@ -31,18 +32,75 @@ struct FInfinitePurchase
 	FName ChosenPortalId = NAME_None;
 };
 
+// History the builder carries from one wave to the next (carry-over budget, anti-repeat memory).
+// Value type so look-ahead planning can advance a copy without touching the live state.
+struct FInfiniteBuilderState
+{
+	int32 CarryOverBudget = 0;
+	int32 LastApexWave = -10000;
+	TMap<FName, int32> LastWaveSeenPreset;
+	TMap<FName, int32> LastWaveSeenSector;
+};
+
+// Spawn point layout of the level, grouped by sector. Collected once per session
+// instead of scanning all spawn point actors on every wave.
+struct FInfiniteSectorTable
+{
+	TArray<FName> AllSectors;
+	TMap<FName, TArray<FName>> SectorToPortalIds;
+	TMap<FName, TArray<FName>> SectorToBossPortalIds;
+	TArray<FName> FlyerFreePortals;
+	bool bIsBuilt = false;
+};
+
+// Every decision made for one wave, before any UObject is created.
+// Produced by PlanWave, which touches no world state and may run off the game thread.
+struct FInfiniteWavePlan
+{
+	int32 WaveIndex = INDEX_NONE;
+	int32 Budget = 0;
+	bool bSpike = false;
+	int32 ThemeIndex = INDEX_NONE;
+	FName ThemeId = NAME_None;
+	FEnemyBuff ScalingBuff;
+	TArray<FInfinitePurchase> Purchases;
+	FInfiniteBuilderState StateAfter;
+};
+
 UCLASS( BlueprintType )
 class LORDS_FRONTIERS_API UInfiniteWaveBuilder : public UObject
 {
 	GENERATED_BODY()
 
 public:
+	virtual void BeginDestroy() override;
+
 	void Initialize( UInfiniteModeConfig* config, int32 sessionSeed );
 
 	void ResetState();
 
 	UWaveData* BuildWave( int32 waveIndex, UObject* worldContextObject );
 
+	// Plans waves [firstWaveIndex, firstWaveIndex + count) on a worker thread, starting from the
+	// current state. BuildWave consumes the plans in order; any other call invalidates them.
+	void PrecomputeAhead( int32 firstWaveIndex, int32 count, UObject* worldContextObject );
+
+	// Enemy counts of an already planned (not yet built) wave. False if no valid plan exists.
+	bool TryGetPlannedComposition( int32 waveIndex, TMap<TSubclassOf<AUnit>, int32>& outComposition ) const;
+
+	// Enemy classes of all currently planned waves, for pool warm-up.
+	void GetPlannedEnemyClasses( TSet<TSubclassOf<AUnit>>& outClasses ) const;
+
+	// Headless use (offline tools): replaces the level scan with a prepared sector table.
+	void SetSectorTable( const FInfiniteSectorTable& table );
+
+	// Headless use: plans and commits the wave without creating UWaveData or touching the world.
+	// Thread-safe across distinct builder instances.
+	FInfiniteWavePlan SimulateWave( int32 waveIndex );
+
+	// Broadcast on the game thread when a look-ahead batch has been accepted.
+	FSimpleMulticastDelegate OnLookAheadReady;
+
 	UPROPERTY( Transient, BlueprintReadOnly )
 	FName LastThemeId = NAME_None;
 
@@ -58,42 +116,63 @@ private:
 
 	int32 SessionSeed = 0;
 
-	int32 CarryOverBudget = 0;
-	int32 LastApexWave = -10000;
-	TMap<FName, int32> LastWaveSeenPreset_;
-	TMap<FName, int32> LastWaveSeenSector_;
+	FInfiniteBuilderState State_;
+	FInfiniteSectorTable SectorTable_;
 
-	int32 ComputeBudget( int32 waveIndex ) const;
+	// Bumped whenever State_ changes outside of consuming a look-ahead plan.
+	int32 StateGeneration_ = 0;
+
+	TArray<FInfiniteWavePlan> LookAheadPlans_;
+	int32 LookAheadGeneration_ = INDEX_NONE;
+
+	TFuture<TArray<FInfiniteWavePlan>> PendingLookAhead_;
+	int32 PendingGeneration_ = INDEX_NONE;
+
+	int32 ComputeBudget( int32 waveIndex, const FInfiniteBuilderState& state ) const;
 	bool IsSpikeWave( int32 waveIndex ) const;
 	FEnemyBuff ComputeScalingBuff( int32 waveIndex ) const;
 
 	const FInfiniteTheme* RollTheme( FRandomStream& rng, int32 waveIndex, bool bSpike ) const;
 	float PresetWeight(
 	    const UEnemyPresetData* preset, const FInfiniteTheme& theme, int32 waveIndex, int32 remainingBudget,
-	    const TMap<FName, int32>& usedThisWave, bool bCoreOnly
+	    const TMap<FName, int32>& usedThisWave, bool bCoreOnly, const FInfiniteBuilderState& state
 	) const;
 
 	UEnemyPresetData* PickPreset(
 	    FRandomStream& rng, const FInfiniteTheme& theme, int32 waveIndex, int32 remainingBudget,
-	    const TMap<FName, int32>& usedThisWave, bool bCoreOnly, bool bOffThemeOnly
+	    const TMap<FName, int32>& usedThisWave, bool bCoreOnly, bool bOffThemeOnly,
+	    const FInfiniteBuilderState& state
 	) const;
 
-	TArray<FName> CollectAllSectors( UObject* worldContextObject ) const;
+	void EnsureSectorTable( UObject* worldContextObject );
 	TArray<FName> PickActiveSectors(
 	    FRandomStream& rng, const FInfiniteTheme& theme, int32 waveIndex,
-	    const TArray<FName>& allSectors
+	    const TArray<FName>& allSectors, const FInfiniteBuilderState& state
 	) const;
 	void AssignPortalsToPurchases(
 	    FRandomStream& rng, TArray<FInfinitePurchase>& purchases, const TArray<FName>& activeSectors,
 	    const TMap<FName, TArray<FName>>& sectorToPortalIds, const TArray<FName>& flyerFreePortals
-	);
-
-	UWaveData* AssembleWaveData(
-	    const TArray<FInfinitePurchase>& purchases, const FInfiniteTheme& theme, const FEnemyBuff& scalingBuff,
-	    bool bSpike
 	) const;
 
+	// Pure: rolls the whole wave from the given state and sector table. Safe on worker threads
+	// as long as Config is not edited meanwhile.
+	FInfiniteWavePlan
+	PlanWave( int32 waveIndex, const FInfiniteBuilderState& state, const FInfiniteSectorTable& sectors ) const;
+
+	UWaveData* AssembleWaveData( const FInfiniteWavePlan& plan ) const;
+
 	float RecencyMultiplier( int32 lastSeenWave, int32 currentWave ) const;
 
-	void RememberWave( int32 waveIndex, const TArray<FInfinitePurchase>& purchases, bool bApexSeen );
+	static void RememberWave(
+	    FInfiniteBuilderState& state, int32 waveIndex, const TArray<FInfinitePurchase>& purchases, bool bApexSeen
+	);
+
+	void CommitPlan( const FInfiniteWavePlan& plan );
+
+	// Moves a finished worker batch into LookAheadPlans_. Blocks if bWait and the batch is still running.
+	void CollectLookAhead( bool bWait );
+
+	void DiscardLookAhead();
+
+	const FInfiniteWavePlan* FindPlan( int32 waveIndex ) const;
 };
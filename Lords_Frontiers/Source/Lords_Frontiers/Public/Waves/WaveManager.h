@@ -63,6 +63,12 @@ public:
 		return bIsWaveActive_;
 	}
 
+	// True while a wave is running or its spawn timers or units are still around; nothing to cancel otherwise
+	bool HasWaveInProgress() const
+	{
+		return bIsWaveActive_ || ActiveSpawnTimers_.Num() > 0 || SpawnedUnits_.Num() > 0;
+	}
+
 	UFUNCTION( BlueprintPure, Category = "Settings|Wave" )
 	bool IsFirstWaveRequested() const
 	{
@@ -135,6 +141,10 @@ public:
 	UPROPERTY( EditAnywhere, Category = "Settings|WaveConfig" )
 	TObjectPtr<UWaveConfigData> WaveConfig_ = nullptr;
 
+	// Projectiles pooled on BeginPlay for each ranged enemy class any preset of WaveConfig_ can spawn
+	UPROPERTY( EditAnywhere, Category = "Settings|WaveConfig", meta = ( ClampMin = "0" ) )
+	int32 ProjectileWarmupPerEnemyClass = 8;
+
 	UFUNCTION( BlueprintCallable, Category = "Wave|Config" )
 	void SetWaveConfig( UWaveConfigData* newConfig );
 
@@ -245,4 +255,18 @@ private:
 	void EnsureInfiniteBuilder();
 
 	UWaveData* BuildAndCacheInfiniteWave( int32 waveIndex );
+
+	// Starts background planning of the next infinite waves (build phase).
+	void PrecomputeInfiniteWaves( int32 nextWaveIndex );
+
+	// Warms projectile pools for enemy classes of the planned waves and refreshes wave UI.
+	void HandleInfiniteLookAheadReady();
+
+	// Warms pools for every enemy class the presets of WaveConfig_ can spawn, before the first build phase.
+	void PreWarmPoolsForWaveConfig() const;
+
+	// Tops each ranged class's projectile pool up to projectilesPerClass and warms the classes' health bars.
+	void PreWarmPoolsForEnemyClasses( const TSet<TSubclassOf<AUnit>>& enemyClasses, int32 projectilesPerClass ) const;
+
+	FDelegateHandle LookAheadReadyHandle_;
 };
@@ -0,0 +1,233 @@
+#include "SessionLogger/SessionLogQueryCommandlet.h"
+
+#include "Core/GameLoop/GameLoopManager.h"
+#include "Core/Subsystems/SessionLogger/SessionEventLog.h"
+
+#include "Algo/Count.h"
+#include "Async/ParallelFor.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC( LogSessionLogQuery, Log, All );
+
+namespace
+{
+	struct FEconomySum
+	{
+		int64 Gold = 0;
+		int64 Food = 0;
+		int64 Population = 0;
+		int64 Progress = 0;
+		int32 Samples = 0;
+	};
+
+	// What one file contributes; merged once every worker is done
+	struct FQueryPartial
+	{
+		bool bLoaded = false;
+
+		// (tower class, wave) -> damage
+		TMap<TPair<FName, int32>, int64> TowerDamage;
+		// wave -> combat seconds
+		TMap<int32, double> CombatSeconds;
+		// (wave, turn) -> resources at turn end
+		TMap<TPair<int32, int32>, FEconomySum> Economy;
+	};
+
+	void CollectTowerDps( const FSessionEventLog& log, FQueryPartial& out )
+	{
+		const FSessionPhaseColumns& phases = log.Phases;
+		const uint8 combat = static_cast<uint8>( EGameLoopPhase::Combat );
+
+		float combatStart = -1.0f;
+		int32 combatWave = 0;
+		for ( int32 row = 0; row < phases.Time.Num(); ++row )
+		{
+			if ( phases.OldPhase[row] == combat && combatStart >= 0.0f )
+			{
+				out.CombatSeconds.FindOrAdd( combatWave ) += phases.Time[row] - combatStart;
+				combatStart = -1.0f;
+			}
+			if ( phases.NewPhase[row] == combat )
+			{
+				combatStart = phases.Time[row];
+				combatWave = phases.Wave[row];
+			}
+		}
+
+		const FSessionDamageColumns& damage = log.Damage;
+		for ( int32 row = 0; row < damage.Time.Num(); ++row )
+		{
+			if ( ( damage.Flags[row] & SessionEventLog::cFlagFromTower ) == 0 )
+			{
+				continue;
+			}
+			const TPair<FName, int32> key( log.GetName( damage.Source[row] ), damage.Wave[row] );
+			out.TowerDamage.FindOrAdd( key ) += damage.Amount[row];
+		}
+	}
+
+	void CollectEconomy( const FSessionEventLog& log, FQueryPartial& out )
+	{
+		const FSessionResourceColumns& resources = log.Resources;
+		for ( int32 row = 0; row < resources.Time.Num(); ++row )
+		{
+			FEconomySum& sum = out.Economy.FindOrAdd( TPair<int32, int32>( resources.Wave[row], resources.Turn[row] ) );
+			sum.Gold += resources.Gold[row];
+			sum.Food += resources.Food[row];
+			sum.Population += resources.Population[row];
+			sum.Progress += resources.Progress[row];
+			sum.Samples++;
+		}
+	}
+
+	FString BuildTowerDpsCsv( const TArray<FQueryPartial>& partials )
+	{
+		TMap<TPair<FName, int32>, int64> damage;
+		TMap<int32, double> combatSeconds;
+		for ( const FQueryPartial& partial : partials )
+		{
+			for ( const TPair<TPair<FName, int32>, int64>& entry : partial.TowerDamage )
+			{
+				damage.FindOrAdd( entry.Key ) += entry.Value;
+			}
+			for ( const TPair<int32, double>& entry : partial.CombatSeconds )
+			{
+				combatSeconds.FindOrAdd( entry.Key ) += entry.Value;
+			}
+		}
+
+		damage.KeySort(
+		    []( const TPair<FName, int32>& a, const TPair<FName, int32>& b )
+		    { return a.Value != b.Value ? a.Value < b.Value : a.Key.LexicalLess( b.Key ); }
+		);
+
+		FString csv = TEXT( "TowerClass,Wave,Damage,CombatSeconds,DPS\n" );
+		for ( const TPair<TPair<FName, int32>, int64>& entry : damage )
+		{
+			const double seconds = combatSeconds.FindRef( entry.Key.Value );
+			const double dps = seconds > 0.0 ? static_cast<double>( entry.Value ) / seconds : 0.0;
+			csv += FString::Printf(
+			    TEXT( "%s,%d,%lld,%.2f,%.2f\n" ), *entry.Key.Key.ToString(), entry.Key.Value, entry.Value, seconds, dps
+			);
+		}
+		return csv;
+	}
+
+	FString BuildEconomyCsv( const TArray<FQueryPartial>& partials )
+	{
+		TMap<TPair<int32, int32>, FEconomySum> economy;
+		for ( const FQueryPartial& partial : partials )
+		{
+			for ( const TPair<TPair<int32, int32>, FEconomySum>& entry : partial.Economy )
+			{
+				FEconomySum& sum = economy.FindOrAdd( entry.Key );
+				sum.Gold += entry.Value.Gold;
+				sum.Food += entry.Value.Food;
+				sum.Population += entry.Value.Population;
+				sum.Progress += entry.Value.Progress;
+				sum.Samples += entry.Value.Samples;
+			}
+		}
+
+		economy.KeySort(
+		    []( const TPair<int32, int32>& a, const TPair<int32, int32>& b )
+		    { return a.Key != b.Key ? a.Key < b.Key : a.Value < b.Value; }
+		);
+
+		FString csv = TEXT( "Wave,Turn,Sessions,Gold,Food,Population,Progress\n" );
+		for ( const TPair<TPair<int32, int32>, FEconomySum>& entry : economy )
+		{
+			const FEconomySum& sum = entry.Value;
+			const double samples = FMath::Max( sum.Samples, 1 );
+			csv += FString::Printf(
+			    TEXT( "%d,%d,%d,%.1f,%.1f,%.1f,%.1f\n" ), entry.Key.Key, entry.Key.Value, sum.Samples,
+			    sum.Gold / samples, sum.Food / samples, sum.Population / samples, sum.Progress / samples
+			);
+		}
+		return csv;
+	}
+}
+
+USessionLogQueryCommandlet::USessionLogQueryCommandlet()
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 USessionLogQueryCommandlet::Main( const FString& params )
+{
+	FString dir = FPaths::ProjectDir() / TEXT( "SessionLogs" );
+	FParse::Value( *params, TEXT( "Dir=" ), dir );
+
+	FString query;
+	FParse::Value( *params, TEXT( "Query=" ), query );
+	const bool bTowerDps = query.Equals( TEXT( "TowerDps" ), ESearchCase::IgnoreCase );
+	const bool bEconomy = query.Equals( TEXT( "Economy" ), ESearchCase::IgnoreCase );
+	if ( !bTowerDps && !bEconomy )
+	{
+		UE_LOG(
+		    LogSessionLogQuery, Error, TEXT( "Usage: -run=SessionLogQuery [-Dir=] -Query=TowerDps|Economy [-Out=]" )
+		);
+		return 1;
+	}
+
+	TArray<FString> files;
+	IFileManager::Get().FindFiles( files, *( dir / TEXT( "*.lfslog" ) ), true, false );
+	if ( files.IsEmpty() )
+	{
+		UE_LOG( LogSessionLogQuery, Warning, TEXT( "No session logs in %s" ), *dir );
+		return 1;
+	}
+
+	// Each worker loads and reduces its own files; nothing is shared until the merge.
+	TArray<FQueryPartial> partials;
+	partials.SetNum( files.Num() );
+	ParallelFor(
+	    files.Num(),
+	    [&]( const int32 index )
+	    {
+		    FSessionEventLog log;
+		    if ( !FSessionEventLog::LoadFromFile( dir / files[index], log ) )
+		    {
+			    return;
+		    }
+
+		    FQueryPartial& partial = partials[index];
+		    partial.bLoaded = true;
+		    if ( bTowerDps )
+		    {
+			    CollectTowerDps( log, partial );
+		    }
+		    else
+		    {
+			    CollectEconomy( log, partial );
+		    }
+	    }
+	);
+
+	const int32 loaded = Algo::CountIf( partials, []( const FQueryPartial& partial ) { return partial.bLoaded; } );
+	UE_LOG( LogSessionLogQuery, Display, TEXT( "%d of %d session logs read" ), loaded, files.Num() );
+
+	const FString csv = bTowerDps ? BuildTowerDpsCsv( partials ) : BuildEconomyCsv( partials );
+
+	FString outPath;
+	if ( FParse::Value( *params, TEXT( "Out=" ), outPath ) )
+	{
+		if ( !FFileHelper::SaveStringToFile( csv, *outPath ) )
+		{
+			UE_LOG( LogSessionLogQuery, Error, TEXT( "Failed to write %s" ), *outPath );
+			return 1;
+		}
+		UE_LOG( LogSessionLogQuery, Display, TEXT( "Wrote %s" ), *outPath );
+	}
+	else
+	{
+		UE_LOG( LogSessionLogQuery, Display, TEXT( "\n%s" ), *csv );
+	}
+
+	return 0;
+}
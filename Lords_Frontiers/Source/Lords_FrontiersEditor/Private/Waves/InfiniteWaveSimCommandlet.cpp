@@ -0,0 +1,331 @@
+#include "Waves/InfiniteWaveSimCommandlet.h"
+
+#include "Waves/Infinite/InfiniteModeConfig.h"
+#include "Waves/Infinite/InfiniteWaveBuilder.h"
+
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+
+DEFINE_LOG_CATEGORY_STATIC( LogInfiniteWaveSim, Log, All );
+
+namespace
+{
+	constexpr int32 cDefaultSeeds = 2000;
+	constexpr int32 cDefaultWaves = 200;
+
+	struct FSimWaveSample
+	{
+		int32 Budget = 0;
+		int32 Spent = 0;
+		int32 Enemies = 0;
+		int32 ThemeIndex = INDEX_NONE;
+		bool bSpike = false;
+	};
+
+	struct FSimPresetStats
+	{
+		int64 Picks = 0;
+		int64 WavesPresent = 0;
+		int64 Reappearances = 0;
+		int64 GapSum = 0;
+		int32 MinGap = MAX_int32;
+	};
+
+	struct FSimSeedResult
+	{
+		TArray<FSimWaveSample> Waves;
+		TMap<FName, FSimPresetStats> Presets;
+	};
+
+	// Every sector of the ring gets one boss-capable portal, so purchases are never dropped for
+	// lack of spawn points and the sweep measures the builder rather than a particular level.
+	FInfiniteSectorTable MakeSyntheticSectorTable( const UInfiniteModeConfig* config )
+	{
+		FInfiniteSectorTable table;
+
+		TArray<FName> sectors = config->SectorRing;
+		if ( sectors.Num() == 0 )
+		{
+			sectors.Add( FName( TEXT( "Default" ) ) );
+		}
+
+		for ( const FName& sector : sectors )
+		{
+			const FName portalId( *FString::Printf( TEXT( "Sim_%s" ), *sector.ToString() ) );
+			table.AllSectors.Add( sector );
+			table.SectorToPortalIds.FindOrAdd( sector ).Add( portalId );
+			table.SectorToBossPortalIds.FindOrAdd( sector ).Add( portalId );
+			table.FlyerFreePortals.Add( portalId );
+		}
+
+		table.bIsBuilt = true;
+		return table;
+	}
+
+	void SimulateSeed( UInfiniteWaveBuilder* builder, int32 firstWave, int32 numWaves, FSimSeedResult& out )
+	{
+		out.Waves.SetNum( numWaves );
+		TMap<FName, int32> lastSeen;
+
+		for ( int32 i = 0; i < numWaves; ++i )
+		{
+			const int32 waveIndex = firstWave + i;
+			const FInfiniteWavePlan plan = builder->SimulateWave( waveIndex );
+
+			FSimWaveSample& sample = out.Waves[i];
+			sample.Budget = plan.Budget;
+			sample.Spent = plan.Budget - plan.StateAfter.CarryOverBudget;
+			sample.ThemeIndex = plan.ThemeIndex;
+			sample.bSpike = plan.bSpike;
+
+			TSet<FName> presentThisWave;
+			for ( const FInfinitePurchase& p : plan.Purchases )
+			{
+				if ( !p.Preset )
+				{
+					continue;
+				}
+				sample.Enemies += p.Preset->Count * p.Times;
+
+				const FName presetName = p.Preset->GetFName();
+				out.Presets.FindOrAdd( presetName ).Picks += p.Times;
+				presentThisWave.Add( presetName );
+			}
+
+			for ( const FName& presetName : presentThisWave )
+			{
+				FSimPresetStats& stats = out.Presets.FindOrAdd( presetName );
+				++stats.WavesPresent;
+				if ( const int32* prev = lastSeen.Find( presetName ) )
+				{
+					const int32 gap = waveIndex - *prev;
+					++stats.Reappearances;
+					stats.GapSum += gap;
+					stats.MinGap = FMath::Min( stats.MinGap, gap );
+				}
+				lastSeen.FindOrAdd( presetName ) = waveIndex;
+			}
+		}
+	}
+
+	int32 Percentile( TArray<int32>& sortedValues, float fraction )
+	{
+		if ( sortedValues.Num() == 0 )
+		{
+			return 0;
+		}
+		const int32 idx = FMath::Clamp(
+		    FMath::FloorToInt( fraction * static_cast<float>( sortedValues.Num() - 1 ) ), 0, sortedValues.Num() - 1
+		);
+		return sortedValues[idx];
+	}
+
+	FString BuildWaveCsv(
+	    const TArray<FSimSeedResult>& results, const TArray<FInfiniteWavePlan>& referencePlans, int32 firstWave,
+	    int32 numWaves
+	)
+	{
+		FString csv = TEXT( "Wave,SpikeShare,BudgetMean,BudgetMin,BudgetMax,SpentMean,BudgetUse,"
+		                    "EnemiesMean,EnemiesP10,EnemiesP50,EnemiesP90,EnemiesMax,"
+		                    "HealthMul,RangeMul,DamageMul,CooldownMul,SpeedMul\n" );
+
+		TArray<int32> enemies;
+		enemies.Reserve( results.Num() );
+
+		for ( int32 i = 0; i < numWaves; ++i )
+		{
+			int64 budgetSum = 0;
+			int64 spentSum = 0;
+			int32 budgetMin = MAX_int32;
+			int32 budgetMax = 0;
+			int32 spikes = 0;
+			enemies.Reset();
+
+			for ( const FSimSeedResult& result : results )
+			{
+				const FSimWaveSample& sample = result.Waves[i];
+				budgetSum += sample.Budget;
+				spentSum += sample.Spent;
+				budgetMin = FMath::Min( budgetMin, sample.Budget );
+				budgetMax = FMath::Max( budgetMax, sample.Budget );
+				spikes += sample.bSpike ? 1 : 0;
+				enemies.Add( sample.Enemies );
+			}
+
+			enemies.Sort();
+			int64 enemySum = 0;
+			for ( const int32 e : enemies )
+			{
+				enemySum += e;
+			}
+
+			const double n = FMath::Max( 1, results.Num() );
+			const double budgetMean = budgetSum / n;
+			const double spentMean = spentSum / n;
+			const FEnemyBuff& buff = referencePlans[i].ScalingBuff;
+
+			csv += FString::Printf(
+			    TEXT( "%d,%.3f,%.1f,%d,%d,%.1f,%.3f,%.2f,%d,%d,%d,%d,%.3f,%.3f,%.3f,%.3f,%.3f\n" ), firstWave + i,
+			    spikes / n, budgetMean, budgetMin, budgetMax, spentMean,
+			    budgetMean > 0.0 ? spentMean / budgetMean : 0.0, enemySum / n, Percentile( enemies, 0.1f ),
+			    Percentile( enemies, 0.5f ), Percentile( enemies, 0.9f ), enemies.Num() > 0 ? enemies.Last() : 0,
+			    buff.HealthMultiplier, buff.AttackRangeMultiplier, buff.AttackDamageMultiplier,
+			    buff.AttackCooldownMultiplier, buff.MaxSpeedMultiplier
+			);
+		}
+
+		return csv;
+	}
+
+	FString BuildThemeCsv( const UInfiniteModeConfig* config, const TArray<FSimSeedResult>& results, int32 numWaves )
+	{
+		TArray<int64> counts;
+		counts.SetNumZeroed( config->Themes.Num() + 1 );
+
+		for ( const FSimSeedResult& result : results )
+		{
+			for ( const FSimWaveSample& sample : result.Waves )
+			{
+				const int32 slot = config->Themes.IsValidIndex( sample.ThemeIndex ) ? sample.ThemeIndex
+				                                                                     : config->Themes.Num();
+				++counts[slot];
+			}
+		}
+
+		const double total = FMath::Max<double>( 1.0, static_cast<double>( results.Num() ) * numWaves );
+		FString csv = TEXT( "Theme,Waves,Share\n" );
+		for ( int32 t = 0; t < counts.Num(); ++t )
+		{
+			const FString name =
+			    config->Themes.IsValidIndex( t ) ? config->Themes[t].ThemeId.ToString() : FString( TEXT( "<fallback>" ) );
+			csv += FString::Printf( TEXT( "%s,%lld,%.4f\n" ), *name, counts[t], counts[t] / total );
+		}
+		return csv;
+	}
+
+	FString BuildPresetCsv( const TArray<FSimSeedResult>& results, int32 numWaves )
+	{
+		TMap<FName, FSimPresetStats> merged;
+		for ( const FSimSeedResult& result : results )
+		{
+			for ( const TPair<FName, FSimPresetStats>& pair : result.Presets )
+			{
+				FSimPresetStats& dst = merged.FindOrAdd( pair.Key );
+				dst.Picks += pair.Value.Picks;
+				dst.WavesPresent += pair.Value.WavesPresent;
+				dst.Reappearances += pair.Value.Reappearances;
+				dst.GapSum += pair.Value.GapSum;
+				dst.MinGap = FMath::Min( dst.MinGap, pair.Value.MinGap );
+			}
+		}
+
+		const double totalWaves = FMath::Max<double>( 1.0, static_cast<double>( results.Num() ) * numWaves );
+		FString csv = TEXT( "Preset,Picks,PicksPerWave,WavePresence,MeanReappearGap,MinReappearGap\n" );
+		for ( const TPair<FName, FSimPresetStats>& pair : merged )
+		{
+			const FSimPresetStats& stats = pair.Value;
+			csv += FString::Printf(
+			    TEXT( "%s,%lld,%.3f,%.4f,%.2f,%d\n" ), *pair.Key.ToString(), stats.Picks, stats.Picks / totalWaves,
+			    stats.WavesPresent / totalWaves,
+			    stats.Reappearances > 0 ? static_cast<double>( stats.GapSum ) / stats.Reappearances : 0.0,
+			    stats.MinGap == MAX_int32 ? 0 : stats.MinGap
+			);
+		}
+		return csv;
+	}
+} // namespace
+
+UInfiniteWaveSimCommandlet::UInfiniteWaveSimCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UInfiniteWaveSimCommandlet::Main( const FString& params )
+{
+	FString configPath;
+	if ( !FParse::Value( *params, TEXT( "Config=" ), configPath ) )
+	{
+		UE_LOG( LogInfiniteWaveSim, Error, TEXT( "Missing -Config=<UInfiniteModeConfig object path>." ) );
+		return 1;
+	}
+
+	UInfiniteModeConfig* config = LoadObject<UInfiniteModeConfig>( nullptr, *configPath );
+	if ( !config || config->Presets.Num() == 0 )
+	{
+		UE_LOG( LogInfiniteWaveSim, Error, TEXT( "Config '%s' not found or has no presets." ), *configPath );
+		return 1;
+	}
+
+	int32 numSeeds = cDefaultSeeds;
+	int32 numWaves = cDefaultWaves;
+	int32 firstSeed = 1;
+	FString outDir = FPaths::ProjectSavedDir() / TEXT( "InfiniteWaveSim" );
+	FParse::Value( *params, TEXT( "Seeds=" ), numSeeds );
+	FParse::Value( *params, TEXT( "Waves=" ), numWaves );
+	FParse::Value( *params, TEXT( "FirstSeed=" ), firstSeed );
+	FParse::Value( *params, TEXT( "Out=" ), outDir );
+	numSeeds = FMath::Max( 1, numSeeds );
+	numWaves = FMath::Max( 1, numWaves );
+
+	const int32 firstWave = config->StartWaveIndex;
+	const FInfiniteSectorTable sectors = MakeSyntheticSectorTable( config );
+
+	// UObjects are created here on the game thread; the parallel part only runs planning.
+	Builders_.Reset( numSeeds );
+	for ( int32 s = 0; s < numSeeds; ++s )
+	{
+		UInfiniteWaveBuilder* builder = NewObject<UInfiniteWaveBuilder>( GetTransientPackage() );
+		builder->Initialize( config, firstSeed + s );
+		builder->SetSectorTable( sectors );
+		Builders_.Add( builder );
+	}
+
+	const double startTime = FPlatformTime::Seconds();
+
+	TArray<FSimSeedResult> results;
+	results.SetNum( numSeeds );
+	ParallelFor(
+	    numSeeds, [this, &results, firstWave, numWaves]( int32 s )
+	    { SimulateSeed( Builders_[s], firstWave, numWaves, results[s] ); }
+	);
+
+	const double elapsed = FPlatformTime::Seconds() - startTime;
+
+	// Scaling does not depend on the seed; one extra run provides the reference curve.
+	UInfiniteWaveBuilder* probe = Builders_[0];
+	probe->Initialize( config, firstSeed );
+	probe->SetSectorTable( sectors );
+	TArray<FInfiniteWavePlan> referencePlans;
+	referencePlans.Reserve( numWaves );
+	for ( int32 i = 0; i < numWaves; ++i )
+	{
+		referencePlans.Add( probe->SimulateWave( firstWave + i ) );
+	}
+
+	const bool bSaved =
+	    FFileHelper::SaveStringToFile(
+	        BuildWaveCsv( results, referencePlans, firstWave, numWaves ), *( outDir / TEXT( "waves.csv" ) )
+	    )
+	    && FFileHelper::SaveStringToFile( BuildThemeCsv( config, results, numWaves ), *( outDir / TEXT( "themes.csv" ) ) )
+	    && FFileHelper::SaveStringToFile( BuildPresetCsv( results, numWaves ), *( outDir / TEXT( "presets.csv" ) ) );
+
+	Builders_.Reset();
+
+	if ( !bSaved )
+	{
+		UE_LOG( LogInfiniteWaveSim, Error, TEXT( "Failed to write results to %s" ), *outDir );
+		return 1;
+	}
+
+	UE_LOG(
+	    LogInfiniteWaveSim, Display, TEXT( "Simulated %d seeds x %d waves in %.2fs. Results: %s" ), numSeeds, numWaves,
+	    elapsed, *outDir
+	);
+	return 0;
+}
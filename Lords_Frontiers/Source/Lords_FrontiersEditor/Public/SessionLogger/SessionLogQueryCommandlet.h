@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "CoreMinimal.h"
+
+#include "SessionLogQueryCommandlet.generated.h"
+
+/**
+ * Aggregates a directory of binary session logs (.lfslog), one file per worker.
+ *
+ * -run=SessionLogQuery [-Dir=<folder>] -Query=<TowerDps|Economy> [-Out=<file.csv>]
+ *
+ * TowerDps: damage dealt by each tower class per wave, over the combat seconds of the sessions that reached it.
+ * Economy:  average resources at the end of each turn, per wave and turn.
+ *
+ * Dir defaults to <Project>/SessionLogs. Without -Out the CSV goes to the log.
+ */
+UCLASS()
+class LORDS_FRONTIERSEDITOR_API USessionLogQueryCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	USessionLogQueryCommandlet();
+
+	virtual int32 Main( const FString& params ) override;
+};
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "CoreMinimal.h"
+
+#include "InfiniteWaveSimCommandlet.generated.h"
+
+class UInfiniteModeConfig;
+class UInfiniteWaveBuilder;
+
+/*
+ Offline balance sweep for the infinite mode.
+ Runs UInfiniteWaveBuilder headlessly for many session seeds in parallel and writes
+ aggregated per-wave, per-theme and per-preset statistics as CSV.
+
+ UnrealEditor-Cmd.exe Lords_Frontiers.uproject -run=InfiniteWaveSim
+     -Config=/Game/Path/DA_InfiniteMode.DA_InfiniteMode [-Seeds=2000] [-Waves=200] [-FirstSeed=1] [-Out=Dir]
+ */
+UCLASS()
+class LORDS_FRONTIERSEDITOR_API UInfiniteWaveSimCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UInfiniteWaveSimCommandlet();
+
+	virtual int32 Main( const FString& params ) override;
+
+private:
+	UPROPERTY()
+	TArray<TObjectPtr<UInfiniteWaveBuilder>> Builders_;
+};